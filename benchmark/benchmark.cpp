@@ -0,0 +1,526 @@
+/**
+ * Copyright 2021-2026 Hagen Möbius
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+**/
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <format>
+#include <iostream>
+#include <limits>
+#include <map>
+#include <new>
+#include <optional>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include <xml_parser/basic_parser.h>
+#include <xml_parser/parser.h>
+#include <xml_parser/writer.h>
+
+#include "corpus_generator.h"
+
+/**
+ * Every allocation of the process is counted, so that the allocations of the parser can be
+ * measured without instrumenting it.
+ **/
+namespace
+{
+    auto AllocationCount = std::atomic<std::uint64_t>{0};
+}
+
+// not inlined, so that the compiler does not see malloc() and free() paired with new and delete
+[[gnu::noinline]] auto operator new(std::size_t Size) -> void *
+{
+    AllocationCount.fetch_add(1, std::memory_order_relaxed);
+    if(auto Result = std::malloc((Size > 0) ? Size : 1))
+    {
+        return Result;
+    }
+    
+    throw std::bad_alloc{};
+}
+
+[[gnu::noinline]] auto operator delete(void * Pointer) noexcept -> void
+{
+    std::free(Pointer);
+}
+
+[[gnu::noinline]] auto operator delete(void * Pointer, std::size_t) noexcept -> void
+{
+    std::free(Pointer);
+}
+
+enum class Mode
+{
+    Basic,
+    Parser,
+    Skip,
+    View,
+    Write
+};
+
+constexpr auto Modes = std::array{Mode::Basic, Mode::Parser, Mode::Skip, Mode::View, Mode::Write};
+
+auto GetModeName(Mode Mode) -> std::string_view
+{
+    switch(Mode)
+    {
+    case Mode::Basic:
+        {
+            return "basic";
+        }
+    case Mode::Parser:
+        {
+            return "parser";
+        }
+    case Mode::Skip:
+        {
+            return "skip";
+        }
+    case Mode::View:
+        {
+            return "view";
+        }
+    case Mode::Write:
+        {
+            return "write";
+        }
+    }
+    
+    return {};
+}
+
+/**
+ * Uses the callbacks with std::string and std::map arguments.
+ **/
+class CountingParser : public XML::Parser
+{
+public:
+    CountingParser(std::span<char const> Data) :
+        XML::Parser{Data}
+    {
+    }
+    
+    std::uint64_t m_EventCount = 0;
+private:
+    auto Comment([[maybe_unused]] std::string const & Comment, [[maybe_unused]] XML::Location const & StartLocation) -> void override
+    {
+        ++m_EventCount;
+    }
+    
+    auto ElementStart([[maybe_unused]] std::string const & TagName, [[maybe_unused]] std::map<std::string, std::string> const & Attributes, [[maybe_unused]] XML::Location const & StartLocation) -> void override
+    {
+        ++m_EventCount;
+    }
+    
+    auto ElementEnd([[maybe_unused]] std::string const & TagName) -> void override
+    {
+        ++m_EventCount;
+    }
+    
+    auto Text([[maybe_unused]] std::string const & Text, [[maybe_unused]] XML::Location const & StartLocation) -> void override
+    {
+        ++m_EventCount;
+    }
+};
+
+/**
+ * Uses the view callbacks.
+ **/
+class CountingViewParser : public XML::Parser
+{
+public:
+    CountingViewParser(std::span<char const> Data) :
+        XML::Parser{Data}
+    {
+    }
+    
+    std::uint64_t m_EventCount = 0;
+private:
+    auto CommentView([[maybe_unused]] std::string_view Comment, [[maybe_unused]] XML::Location const & StartLocation) -> void override
+    {
+        ++m_EventCount;
+    }
+    
+    auto ElementStartView([[maybe_unused]] std::string_view TagName, [[maybe_unused]] XML::Attributes Attributes, [[maybe_unused]] XML::Location const & StartLocation) -> void override
+    {
+        ++m_EventCount;
+    }
+    
+    auto ElementEndView([[maybe_unused]] std::string_view TagName) -> void override
+    {
+        ++m_EventCount;
+    }
+    
+    auto TextView([[maybe_unused]] std::string_view Text, [[maybe_unused]] XML::Location const & StartLocation) -> void override
+    {
+        ++m_EventCount;
+    }
+};
+
+/**
+ * A handler for the basic parser.
+ **/
+class CountingHandler
+{
+public:
+    auto Comment([[maybe_unused]] std::string_view Comment, [[maybe_unused]] XML::Location const & StartLocation) -> void
+    {
+        ++m_EventCount;
+    }
+    
+    auto ElementStart([[maybe_unused]] std::string_view TagName, [[maybe_unused]] XML::Attributes Attributes, [[maybe_unused]] XML::Location const & StartLocation) -> void
+    {
+        ++m_EventCount;
+    }
+    
+    auto ElementEnd([[maybe_unused]] std::string_view TagName) -> void
+    {
+        ++m_EventCount;
+    }
+    
+    auto Text([[maybe_unused]] std::string_view Text, [[maybe_unused]] XML::Location const & StartLocation) -> void
+    {
+        ++m_EventCount;
+    }
+    
+    std::uint64_t m_EventCount = 0;
+};
+
+/**
+ * A handler for the basic parser that skips the content of every element below the root.
+ **/
+class SkippingHandler
+{
+public:
+    auto ElementStart([[maybe_unused]] std::string_view TagName, [[maybe_unused]] XML::Attributes Attributes, [[maybe_unused]] XML::Location const & StartLocation) -> void
+    {
+        ++m_EventCount;
+        if(m_Depth > 0)
+        {
+            m_Parser->SkipElement();
+        }
+        ++m_Depth;
+    }
+    
+    auto ElementEnd([[maybe_unused]] std::string_view TagName) -> void
+    {
+        ++m_EventCount;
+        --m_Depth;
+    }
+    
+    std::size_t m_Depth = 0;
+    std::uint64_t m_EventCount = 0;
+    XML::BasicParser<SkippingHandler> * m_Parser = nullptr;
+};
+
+/**
+ * A handler for the basic parser that writes every event into the writer, as a pipeline from the
+ * parser to the writer would.
+ **/
+class WritingHandler
+{
+public:
+    WritingHandler(XML::Writer & Writer) :
+        m_Writer{Writer}
+    {
+    }
+    
+    auto Comment(std::string_view Comment, [[maybe_unused]] XML::Location const & StartLocation) -> void
+    {
+        ++m_EventCount;
+        m_Writer.Comment(Comment);
+    }
+    
+    auto ElementStart(std::string_view TagName, XML::Attributes Attributes, [[maybe_unused]] XML::Location const & StartLocation) -> void
+    {
+        ++m_EventCount;
+        m_Writer.ElementStart(TagName, Attributes);
+    }
+    
+    auto ElementEnd([[maybe_unused]] std::string_view TagName) -> void
+    {
+        ++m_EventCount;
+        m_Writer.ElementEnd();
+    }
+    
+    auto Text(std::string_view Text, [[maybe_unused]] XML::Location const & StartLocation) -> void
+    {
+        ++m_EventCount;
+        m_Writer.Text(Text);
+    }
+    
+    std::uint64_t m_EventCount = 0;
+private:
+    XML::Writer & m_Writer;
+};
+
+class Measurement
+{
+public:
+    std::uint64_t AllocationCount;
+    std::uint64_t EventCount;
+    double Seconds;
+};
+
+auto Measure(Mode Mode, std::span<char const> Corpus, XML::LocationTracking LocationTracking) -> Measurement
+{
+    auto Result = Measurement{};
+    auto const AllocationCountBefore = AllocationCount.load();
+    auto const Start = std::chrono::steady_clock::now();
+    
+    switch(Mode)
+    {
+    case Mode::Basic:
+        {
+            auto Handler = CountingHandler{};
+            auto Parser = XML::BasicParser<CountingHandler>{Handler, Corpus};
+            
+            Parser.SetLocationTracking(LocationTracking);
+            Parser.Parse();
+            Result.EventCount = Handler.m_EventCount;
+            
+            break;
+        }
+    case Mode::Parser:
+        {
+            auto Parser = CountingParser{Corpus};
+            
+            Parser.SetLocationTracking(LocationTracking);
+            Parser.Parse();
+            Result.EventCount = Parser.m_EventCount;
+            
+            break;
+        }
+    case Mode::Skip:
+        {
+            auto Handler = SkippingHandler{};
+            auto Parser = XML::BasicParser<SkippingHandler>{Handler, Corpus};
+            
+            Handler.m_Parser = &Parser;
+            Parser.SetLocationTracking(LocationTracking);
+            Parser.Parse();
+            Result.EventCount = Handler.m_EventCount;
+            
+            break;
+        }
+    case Mode::View:
+        {
+            auto Parser = CountingViewParser{Corpus};
+            
+            Parser.SetLocationTracking(LocationTracking);
+            Parser.Parse();
+            Result.EventCount = Parser.m_EventCount;
+            
+            break;
+        }
+    case Mode::Write:
+        {
+            auto Output = std::string{};
+            
+            // the written document is about as large as the corpus
+            Output.reserve(Corpus.size());
+            
+            auto Writer = XML::Writer{Output};
+            auto Handler = WritingHandler{Writer};
+            auto Parser = XML::BasicParser<WritingHandler>{Handler, Corpus};
+            
+            Parser.SetLocationTracking(LocationTracking);
+            Parser.Parse();
+            Result.EventCount = Handler.m_EventCount;
+            
+            break;
+        }
+    }
+    Result.Seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - Start).count();
+    Result.AllocationCount = AllocationCount.load() - AllocationCountBefore;
+    
+    return Result;
+}
+
+auto PrintUsage() -> void
+{
+    std::cerr << "Usage: xml_parser_benchmark [--json] [--iterations <count>] [--locations <lines|offsets|none>] [--mode <basic|parser|skip|view|write>]... [--profile <name>]... [--seed <number>] [--size <MiB>]\n";
+    std::cerr << "Profiles:";
+    for(auto Profile : CorpusProfiles)
+    {
+        std::cerr << ' ' << GetCorpusProfileName(Profile);
+    }
+    std::cerr << '\n';
+}
+
+/**
+ * Generates a corpus for every profile and parses it several times in every mode. The fastest run
+ * is reported, either as a table or, with --json, as one JSON object per line.
+ **/
+auto main(int argc, char * argv[]) -> int
+{
+    auto Arguments = std::span<char *>{argv, static_cast<std::size_t>(argc)}.subspan(1);
+    auto IterationCount = std::uint64_t{5};
+    auto JSON = false;
+    auto LocationTracking = XML::LocationTracking::LinesAndColumns;
+    auto SelectedModes = std::vector<Mode>{};
+    auto SelectedProfiles = std::vector<CorpusProfile>{};
+    auto Seed = std::uint64_t{1};
+    auto Size = std::uint64_t{16};
+    
+    try
+    {
+        for(auto Index = std::size_t{0}; Index < Arguments.size(); ++Index)
+        {
+            auto const Argument = std::string_view{Arguments[Index]};
+            auto const GetValue = [&]() -> std::string_view
+            {
+                if(Index + 1 == Arguments.size())
+                {
+                    throw std::invalid_argument{std::format("The option {} requires a value.", Argument)};
+                }
+                
+                return Arguments[++Index];
+            };
+            
+            if(Argument == "--json")
+            {
+                JSON = true;
+            }
+            else if(Argument == "--iterations")
+            {
+                IterationCount = std::max(std::stoull(std::string{GetValue()}), 1ull);
+            }
+            else if(Argument == "--locations")
+            {
+                auto const Name = GetValue();
+                
+                if(Name == "lines")
+                {
+                    LocationTracking = XML::LocationTracking::LinesAndColumns;
+                }
+                else if(Name == "offsets")
+                {
+                    LocationTracking = XML::LocationTracking::Offsets;
+                }
+                else if(Name == "none")
+                {
+                    LocationTracking = XML::LocationTracking::None;
+                }
+                else
+                {
+                    throw std::invalid_argument{std::format("Unknown location tracking \"{}\".", Name)};
+                }
+            }
+            else if(Argument == "--mode")
+            {
+                auto const Name = GetValue();
+                auto const Iterator = std::find_if(Modes.begin(), Modes.end(), [Name](auto Mode) { return GetModeName(Mode) == Name; });
+                
+                if(Iterator == Modes.end())
+                {
+                    throw std::invalid_argument{std::format("Unknown mode \"{}\".", Name)};
+                }
+                SelectedModes.push_back(*Iterator);
+            }
+            else if(Argument == "--profile")
+            {
+                auto const Name = GetValue();
+                auto const Profile = ParseCorpusProfileName(Name);
+                
+                if(Profile.has_value() == false)
+                {
+                    throw std::invalid_argument{std::format("Unknown profile \"{}\".", Name)};
+                }
+                SelectedProfiles.push_back(*Profile);
+            }
+            else if(Argument == "--seed")
+            {
+                Seed = std::stoull(std::string{GetValue()});
+            }
+            else if(Argument == "--size")
+            {
+                Size = std::stoull(std::string{GetValue()});
+            }
+            else
+            {
+                throw std::invalid_argument{std::format("Unknown option \"{}\".", Argument)};
+            }
+        }
+    }
+    catch(std::exception const & Exception)
+    {
+        std::cerr << Exception.what() << '\n';
+        PrintUsage();
+        
+        return 1;
+    }
+    if(SelectedModes.empty() == true)
+    {
+        SelectedModes.assign(Modes.begin(), Modes.end());
+    }
+    if(SelectedProfiles.empty() == true)
+    {
+        SelectedProfiles.assign(CorpusProfiles.begin(), CorpusProfiles.end());
+    }
+    if(JSON == false)
+    {
+        std::cout << std::format("{:<16} {:<7} {:>10} {:>10} {:>14} {:>16}\n", "profile", "mode", "size [MiB]", "MiB/s", "events/s", "allocations/MiB");
+    }
+    for(auto Profile : SelectedProfiles)
+    {
+        auto const Corpus = GenerateCorpus(Profile, Size * 1024 * 1024, Seed);
+        auto const Mebibytes = static_cast<double>(Corpus.size()) / (1024.0 * 1024.0);
+        
+        for(auto Mode : SelectedModes)
+        {
+            auto Best = Measurement{0, 0, std::numeric_limits<double>::infinity()};
+            
+            for(auto Iteration = std::uint64_t{0}; Iteration < IterationCount; ++Iteration)
+            {
+                auto const Measurement = Measure(Mode, Corpus, LocationTracking);
+                
+                if(Measurement.Seconds < Best.Seconds)
+                {
+                    Best = Measurement;
+                }
+            }
+            
+            auto const MebibytesPerSecond = Mebibytes / Best.Seconds;
+            auto const EventsPerSecond = static_cast<double>(Best.EventCount) / Best.Seconds;
+            auto const AllocationsPerMebibyte = static_cast<double>(Best.AllocationCount) / Mebibytes;
+            
+            if(JSON == true)
+            {
+                std::cout << std::format("{{\"profile\": \"{}\", \"mode\": \"{}\", \"seed\": {}, \"bytes\": {}, \"events\": {}, \"allocations\": {}, \"seconds\": {:.6f}, \"mebibytes_per_second\": {:.2f}, \"events_per_second\": {:.0f}, \"allocations_per_mebibyte\": {:.2f}}}\n", GetCorpusProfileName(Profile), GetModeName(Mode), Seed, Corpus.size(), Best.EventCount, Best.AllocationCount, Best.Seconds, MebibytesPerSecond, EventsPerSecond, AllocationsPerMebibyte);
+            }
+            else
+            {
+                std::cout << std::format("{:<16} {:<7} {:>10.1f} {:>10.1f} {:>14.0f} {:>16.2f}\n", GetCorpusProfileName(Profile), GetModeName(Mode), Mebibytes, MebibytesPerSecond, EventsPerSecond, AllocationsPerMebibyte);
+            }
+        }
+    }
+    
+    return 0;
+}
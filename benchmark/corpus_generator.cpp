@@ -0,0 +1,236 @@
+/**
+ * Copyright 2026 Hagen Möbius
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+**/
+
+
+#include <cassert>
+
+#include "corpus_generator.h"
+
+namespace
+{
+    /**
+     * SplitMix64, which unlike the engines and distributions of the standard library yields the same
+     * numbers everywhere.
+     **/
+    class Random
+    {
+    public:
+        Random(std::uint64_t Seed) :
+            m_State{Seed}
+        {
+        }
+        
+        auto Next() -> std::uint64_t
+        {
+            m_State += 0x9e3779b97f4a7c15;
+            
+            auto Result = m_State;
+            
+            Result = (Result ^ (Result >> 30)) * 0xbf58476d1ce4e5b9;
+            Result = (Result ^ (Result >> 27)) * 0x94d049bb133111eb;
+            
+            return Result ^ (Result >> 31);
+        }
+        
+        /**
+         * Returns a number from Minimum to Maximum, both included.
+         **/
+        auto Next(std::size_t Minimum, std::size_t Maximum) -> std::size_t
+        {
+            assert(Minimum <= Maximum);
+            
+            return Minimum + static_cast<std::size_t>(Next() % (Maximum - Minimum + 1));
+        }
+    private:
+        std::uint64_t m_State;
+    };
+    
+    constexpr auto Words = std::array<std::string_view, 16>{"lorem", "ipsum", "dolor", "sit", "amet", "consectetur", "adipiscing", "elit", "sed", "do", "eiusmod", "tempor", "incididunt", "ut", "labore", "magna"};
+    constexpr auto Names = std::array<std::string_view, 8>{"id", "type", "name", "class", "href", "lang", "version", "data-value"};
+    constexpr auto Entities = std::array<std::string_view, 7>{"&amp;", "&lt;", "&gt;", "&quot;", "&apos;", "&#233;", "&#x20AC;"};
+    
+    auto AppendWords(std::string & Corpus, Random & Random, std::size_t Count) -> void
+    {
+        for(auto Index = std::size_t{0}; Index < Count; ++Index)
+        {
+            if(Index > 0)
+            {
+                Corpus += ' ';
+            }
+            Corpus += Words[Random.Next(0, Words.size() - 1)];
+        }
+    }
+    
+    auto AppendAttributeHeavy(std::string & Corpus, Random & Random) -> void
+    {
+        Corpus += "\t<item";
+        for(auto Index = std::size_t{0}, Count = Random.Next(3, Names.size()); Index < Count; ++Index)
+        {
+            Corpus += ' ';
+            Corpus += Names[Index];
+            Corpus += "=\"";
+            AppendWords(Corpus, Random, Random.Next(1, 3));
+            Corpus += '"';
+        }
+        Corpus += "/>\n";
+    }
+    
+    auto AppendCommentHeavy(std::string & Corpus, Random & Random) -> void
+    {
+        Corpus += "\t<!-- ";
+        AppendWords(Corpus, Random, Random.Next(5, 40));
+        Corpus += " - ";
+        AppendWords(Corpus, Random, Random.Next(1, 5));
+        Corpus += " -->\n\t<item>";
+        AppendWords(Corpus, Random, Random.Next(1, 3));
+        Corpus += "</item>\n";
+    }
+    
+    auto AppendDeepNesting(std::string & Corpus, Random & Random) -> void
+    {
+        auto const Depth = Random.Next(16, 128);
+        
+        for(auto Level = std::size_t{0}; Level < Depth; ++Level)
+        {
+            Corpus += "<level>";
+        }
+        AppendWords(Corpus, Random, 1);
+        for(auto Level = std::size_t{0}; Level < Depth; ++Level)
+        {
+            Corpus += "</level>";
+        }
+        Corpus += '\n';
+    }
+    
+    auto AppendEntityDense(std::string & Corpus, Random & Random) -> void
+    {
+        Corpus += "\t<item>";
+        for(auto Index = std::size_t{0}, Count = Random.Next(5, 20); Index < Count; ++Index)
+        {
+            Corpus += Entities[Random.Next(0, Entities.size() - 1)];
+            AppendWords(Corpus, Random, 1);
+        }
+        Corpus += "</item>\n";
+    }
+    
+    auto AppendTextHeavy(std::string & Corpus, Random & Random) -> void
+    {
+        Corpus += "\t<paragraph>";
+        for(auto Line = std::size_t{0}, LineCount = Random.Next(1, 8); Line < LineCount; ++Line)
+        {
+            AppendWords(Corpus, Random, Random.Next(20, 120));
+            Corpus += ".\n";
+        }
+        Corpus += "\t</paragraph>\n";
+    }
+}
+
+auto GenerateCorpus(CorpusProfile Profile, std::size_t Size, std::uint64_t Seed) -> std::string
+{
+    auto Corpus = std::string{};
+    auto Random = ::Random{Seed};
+    
+    Corpus.reserve(Size + 4096);
+    Corpus += "<corpus>\n";
+    while(Corpus.size() < Size)
+    {
+        switch(Profile)
+        {
+        case CorpusProfile::AttributeHeavy:
+            {
+                AppendAttributeHeavy(Corpus, Random);
+                
+                break;
+            }
+        case CorpusProfile::CommentHeavy:
+            {
+                AppendCommentHeavy(Corpus, Random);
+                
+                break;
+            }
+        case CorpusProfile::DeepNesting:
+            {
+                AppendDeepNesting(Corpus, Random);
+                
+                break;
+            }
+        case CorpusProfile::EntityDense:
+            {
+                AppendEntityDense(Corpus, Random);
+                
+                break;
+            }
+        case CorpusProfile::TextHeavy:
+            {
+                AppendTextHeavy(Corpus, Random);
+                
+                break;
+            }
+        }
+    }
+    Corpus += "</corpus>\n";
+    
+    return Corpus;
+}
+
+auto GetCorpusProfileName(CorpusProfile Profile) -> std::string_view
+{
+    switch(Profile)
+    {
+    case CorpusProfile::AttributeHeavy:
+        {
+            return "attribute-heavy";
+        }
+    case CorpusProfile::CommentHeavy:
+        {
+            return "comment-heavy";
+        }
+    case CorpusProfile::DeepNesting:
+        {
+            return "deep-nesting";
+        }
+    case CorpusProfile::EntityDense:
+        {
+            return "entity-dense";
+        }
+    case CorpusProfile::TextHeavy:
+        {
+            return "text-heavy";
+        }
+    }
+    assert(false);
+    
+    return {};
+}
+
+auto ParseCorpusProfileName(std::string_view Name) -> std::optional<CorpusProfile>
+{
+    for(auto Profile : CorpusProfiles)
+    {
+        if(GetCorpusProfileName(Profile) == Name)
+        {
+            return Profile;
+        }
+    }
+    
+    return std::nullopt;
+}
@@ -0,0 +1,53 @@
+/**
+ * Copyright 2026 Hagen Möbius
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+**/
+
+#ifndef XML_PARSER__BENCHMARK__CORPUS_GENERATOR_H
+#define XML_PARSER__BENCHMARK__CORPUS_GENERATOR_H
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <string_view>
+
+enum class CorpusProfile
+{
+    AttributeHeavy,
+    CommentHeavy,
+    DeepNesting,
+    EntityDense,
+    TextHeavy
+};
+
+constexpr auto CorpusProfiles = std::array{CorpusProfile::AttributeHeavy, CorpusProfile::CommentHeavy, CorpusProfile::DeepNesting, CorpusProfile::EntityDense, CorpusProfile::TextHeavy};
+
+/**
+ * Generates a document of at least the given size. The same profile, size and seed always produce
+ * the same document, on every platform, so that results can be compared across machines and
+ * versions of the parser.
+ **/
+auto GenerateCorpus(CorpusProfile Profile, std::size_t Size, std::uint64_t Seed) -> std::string;
+auto GetCorpusProfileName(CorpusProfile Profile) -> std::string_view;
+auto ParseCorpusProfileName(std::string_view Name) -> std::optional<CorpusProfile>;
+
+#endif
@@ -0,0 +1,89 @@
+/**
+ * Copyright 2026 Hagen Möbius
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+**/
+
+#ifndef XML_PARSER__ATTRIBUTES_H
+#define XML_PARSER__ATTRIBUTES_H
+
+#include <cstddef>
+#include <optional>
+#include <ranges>
+#include <span>
+#include <string_view>
+
+#include <xml_parser/symbol_table.h>
+
+namespace XML
+{
+    class Attribute
+    {
+    public:
+        std::string_view Name;
+        std::string_view Value;
+        XML::SymbolId NameId = XML::NoSymbol;
+    };
+    
+    /**
+     * The attributes of an element in document order, as a view into the parser's attribute buffer.
+     * Every name occurs only once: a duplicate attribute replaces the value of the earlier one. Like
+     * the attributes themselves, the view is only valid for the duration of the callback.
+     **/
+    class Attributes : public std::ranges::view_interface<XML::Attributes>
+    {
+    public:
+        Attributes() = default;
+        
+        Attributes(std::span<XML::Attribute const> Attributes) :
+            m_Attributes{Attributes}
+        {
+        }
+        
+        auto begin() const -> std::span<XML::Attribute const>::iterator
+        {
+            return m_Attributes.begin();
+        }
+        
+        auto end() const -> std::span<XML::Attribute const>::iterator
+        {
+            return m_Attributes.end();
+        }
+        
+        /**
+         * Searches linearly, which beats hashing for the handful of attributes an element usually has.
+         **/
+        auto Find(std::string_view Name) const -> std::optional<std::string_view>
+        {
+            for(auto const & Attribute : m_Attributes)
+            {
+                if(Attribute.Name == Name)
+                {
+                    return Attribute.Value;
+                }
+            }
+            
+            return std::nullopt;
+        }
+    private:
+        std::span<XML::Attribute const> m_Attributes;
+    };
+}
+
+#endif
@@ -0,0 +1,1615 @@
+/**
+ * Copyright 2026 Hagen Möbius
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+**/
+
+#ifndef XML_PARSER__BASIC_PARSER_H
+#define XML_PARSER__BASIC_PARSER_H
+
+#include <algorithm>
+#include <array>
+#include <cassert>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <filesystem>
+#include <istream>
+#include <memory>
+#include <optional>
+#include <span>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include <xml_parser/attributes.h>
+#include <xml_parser/element_index.h>
+#include <xml_parser/entities.h>
+#include <xml_parser/input_source.h>
+#include <xml_parser/line_index.h>
+#include <xml_parser/location.h>
+#include <xml_parser/scanner.h>
+#include <xml_parser/statistics.h>
+#include <xml_parser/symbol_table.h>
+
+namespace XML
+{
+    namespace Detail
+    {
+        /**
+         * A token collects the characters of a name, a text, a comment or an attribute value. As long
+         * as these characters are contiguous in the current input block, the token only refers to them.
+         * It copies them into its own storage when a decoded entity is appended or when the input block
+         * is about to be replaced. Clearing a token keeps the storage intact, so that views of it remain
+         * valid until the parser continues.
+         **/
+        class Token
+        {
+        public:
+            auto Append(char const * Begin, char const * End) -> void
+            {
+                if(m_Owned == true)
+                {
+                    m_Storage.append(Begin, End);
+                }
+                else if(m_Length == 0)
+                {
+                    m_Begin = Begin;
+                    m_Length = End - Begin;
+                }
+                else if(m_Begin + m_Length == Begin)
+                {
+                    m_Length += End - Begin;
+                }
+                else
+                {
+                    Detach();
+                    m_Storage.append(Begin, End);
+                }
+            }
+            
+            auto Append(std::string_view Characters) -> void
+            {
+                Detach();
+                m_Storage += Characters;
+            }
+            
+            auto Clear() -> void
+            {
+                m_Length = 0;
+                m_Owned = false;
+            }
+            
+            auto Detach() -> void
+            {
+                if(m_Owned == false)
+                {
+                    m_Storage.assign(m_Begin, m_Length);
+                    m_Owned = true;
+                }
+            }
+            
+            auto Empty() const -> bool
+            {
+                return View().empty();
+            }
+            
+            auto RemovePrefix(std::size_t Length) -> void
+            {
+                if(m_Owned == true)
+                {
+                    m_Storage.erase(0, Length);
+                }
+                else
+                {
+                    m_Begin += Length;
+                    m_Length -= Length;
+                }
+            }
+            
+            auto View() const -> std::string_view
+            {
+                if(m_Owned == true)
+                {
+                    return m_Storage;
+                }
+                else
+                {
+                    return {m_Begin, m_Length};
+                }
+            }
+        private:
+            char const * m_Begin = nullptr;
+            std::size_t m_Length = 0;
+            bool m_Owned = false;
+            std::string m_Storage;
+        };
+        
+        /**
+         * Parsing stages:
+         * - 0  ->  document scope
+         * - 1  ->  when '<' is read in the document scope
+         * - 2  ->  when '<!' is read, preparing to open a comment
+         * - 3  ->  when '<!-' is read, preparing to open a comment
+         * - 4  ->  when '<!--' is read, comment opened
+         * - 5  ->  when '<!--' .. '-' is read, preparing to close a comment
+         * - 6  ->  when '<!--' .. '--' is read, comment closing, '>' expected next, which turns around to stage 0
+         * - 7  ->  when '&' is read in the document scope
+         * - 8  ->  when '<' was read but not continued by '!', this is an opening or self-closing tag
+         * - 10 ->  when '/' is read in a tag but not after the opening '<', a self-closing tag
+         * - 11 ->  when '</' is read, a closing tag
+         * - 12 ->  when inside an opening or self-closing tag identifier
+         * - 13 ->  when inside an attribute identifier in an opening or self-closing tag
+         * - 14 ->  when inside a closing tag identifier
+         * - 15 ->  when the tag identifier of an opening or self-closing tag is done
+         * - 16 ->  when a whitespace is read after an attribute identifier
+         * - 17 ->  when '=' is read after an attribute identifier
+         * - 18 ->  when a whitespace is read after a '=' for an attribute
+         * - 19 ->  when inside an attribute value with double quotes
+         * - 20 ->  when '&' is read in an attribute value with double quotes
+         * - 21 ->  when inside an attribute value with single quotes
+         * - 22 ->  when '&' is read in an attribute value with single quotes
+         **/
+        
+        /**
+         * The characters that the state machine distinguishes.
+         **/
+        enum class CharacterClass : std::uint8_t
+        {
+            Ampersand,
+            DoubleQuote,
+            Equals,
+            ExclamationMark,
+            GreaterThan,
+            Hyphen,
+            LessThan,
+            Other,
+            Semicolon,
+            SingleQuote,
+            Slash,
+            Whitespace
+        };
+
+        constexpr auto CharacterClassCount = std::size_t{12};
+
+        /**
+         * What happens with the current character, in addition to switching to the next parsing stage.
+         **/
+        enum class Action : std::uint8_t
+        {
+            None,
+            AppendToAttributeName,
+            AppendToAttributeValue,
+            AppendToComment,
+            AppendToCommentAfterDash,
+            AppendToCommentAfterTwoDashes,
+            AppendToEntity,
+            AppendToTagName,
+            AppendToText,
+            EmitComment,
+            EmitElementEnd,
+            EmitElementStart,
+            EmitElementStartAndEnd,
+            EmitText,
+            ForwardEntityToAttributeValue,
+            ForwardEntityToText,
+            ForwardHeldDashToComment,
+            ResetStartLocation,
+            StartEntityInAttributeValue,
+            StartEntityInText,
+            StoreAttribute
+        };
+
+        constexpr auto ParsingStageCount = std::size_t{23};
+
+        class Transition
+        {
+        public:
+            std::uint8_t NextParsingStage;
+            XML::Detail::Action Action;
+        };
+
+        using TransitionTable = std::array<std::array<Transition, CharacterClassCount>, ParsingStageCount>;
+
+        constexpr auto MakeCharacterClasses() -> std::array<CharacterClass, 256>
+        {
+            auto Result = std::array<CharacterClass, 256>{};
+        
+            Result.fill(CharacterClass::Other);
+            Result[static_cast<unsigned char>('\n')] = CharacterClass::Whitespace;
+            Result[static_cast<unsigned char>('\t')] = CharacterClass::Whitespace;
+            Result[static_cast<unsigned char>(' ')] = CharacterClass::Whitespace;
+            Result[static_cast<unsigned char>('=')] = CharacterClass::Equals;
+            Result[static_cast<unsigned char>('"')] = CharacterClass::DoubleQuote;
+            Result[static_cast<unsigned char>('\'')] = CharacterClass::SingleQuote;
+            Result[static_cast<unsigned char>('<')] = CharacterClass::LessThan;
+            Result[static_cast<unsigned char>('>')] = CharacterClass::GreaterThan;
+            Result[static_cast<unsigned char>('/')] = CharacterClass::Slash;
+            Result[static_cast<unsigned char>('&')] = CharacterClass::Ampersand;
+            Result[static_cast<unsigned char>(';')] = CharacterClass::Semicolon;
+            Result[static_cast<unsigned char>('!')] = CharacterClass::ExclamationMark;
+            Result[static_cast<unsigned char>('-')] = CharacterClass::Hyphen;
+        
+            return Result;
+        }
+
+        constexpr auto SetTransition(TransitionTable & Table, unsigned int ParsingStage, CharacterClass CharacterClass, unsigned int NextParsingStage, Action Action) -> void
+        {
+            Table[ParsingStage][static_cast<std::size_t>(CharacterClass)] = Transition{static_cast<std::uint8_t>(NextParsingStage), Action};
+        }
+
+        constexpr auto SetTransitions(TransitionTable & Table, unsigned int ParsingStage, unsigned int NextParsingStage, Action Action) -> void
+        {
+            for(auto CharacterClassIndex = std::size_t{0}; CharacterClassIndex < CharacterClassCount; ++CharacterClassIndex)
+            {
+                SetTransition(Table, ParsingStage, static_cast<CharacterClass>(CharacterClassIndex), NextParsingStage, Action);
+            }
+        }
+
+        /**
+         * Characters that are not mentioned for a parsing stage are dropped without changing the stage.
+         **/
+        constexpr auto MakeTransitions() -> TransitionTable
+        {
+            auto Result = TransitionTable{};
+        
+            for(auto ParsingStage = 0u; ParsingStage < ParsingStageCount; ++ParsingStage)
+            {
+                SetTransitions(Result, ParsingStage, ParsingStage, Action::None);
+            }
+            // document scope
+            SetTransitions(Result, 0, 0, Action::AppendToText);
+            SetTransition(Result, 0, CharacterClass::LessThan, 1, Action::EmitText);
+            SetTransition(Result, 0, CharacterClass::Ampersand, 7, Action::StartEntityInText);
+            // after '<'
+            SetTransition(Result, 1, CharacterClass::ExclamationMark, 2, Action::None);
+            SetTransition(Result, 1, CharacterClass::Slash, 11, Action::ResetStartLocation);
+            SetTransition(Result, 1, CharacterClass::Other, 12, Action::AppendToTagName);
+            // opening a comment
+            SetTransition(Result, 2, CharacterClass::Hyphen, 3, Action::None);
+            SetTransition(Result, 3, CharacterClass::Hyphen, 4, Action::None);
+            // inside a comment
+            SetTransitions(Result, 4, 4, Action::AppendToComment);
+            SetTransition(Result, 4, CharacterClass::Hyphen, 5, Action::None);
+            SetTransitions(Result, 5, 4, Action::AppendToCommentAfterDash);
+            SetTransition(Result, 5, CharacterClass::Hyphen, 6, Action::None);
+            SetTransition(Result, 6, CharacterClass::Whitespace, 4, Action::AppendToCommentAfterTwoDashes);
+            SetTransition(Result, 6, CharacterClass::Other, 4, Action::AppendToCommentAfterTwoDashes);
+            SetTransition(Result, 6, CharacterClass::Hyphen, 6, Action::ForwardHeldDashToComment);
+            SetTransition(Result, 6, CharacterClass::GreaterThan, 0, Action::EmitComment);
+            // entity in the document scope
+            SetTransition(Result, 7, CharacterClass::Other, 7, Action::AppendToEntity);
+            SetTransition(Result, 7, CharacterClass::Semicolon, 0, Action::ForwardEntityToText);
+            // inside an opening or self-closing tag
+            SetTransition(Result, 8, CharacterClass::GreaterThan, 0, Action::EmitElementStart);
+            SetTransition(Result, 8, CharacterClass::Slash, 10, Action::None);
+            SetTransition(Result, 8, CharacterClass::Other, 13, Action::AppendToAttributeName);
+            SetTransition(Result, 10, CharacterClass::GreaterThan, 0, Action::EmitElementStartAndEnd);
+            // closing tag
+            SetTransition(Result, 11, CharacterClass::GreaterThan, 0, Action::EmitElementEnd);
+            SetTransition(Result, 11, CharacterClass::Other, 14, Action::AppendToTagName);
+            // tag identifiers
+            SetTransition(Result, 12, CharacterClass::Whitespace, 15, Action::None);
+            SetTransition(Result, 12, CharacterClass::GreaterThan, 0, Action::EmitElementStart);
+            SetTransition(Result, 12, CharacterClass::Slash, 10, Action::None);
+            SetTransition(Result, 12, CharacterClass::Hyphen, 12, Action::AppendToTagName);
+            SetTransition(Result, 12, CharacterClass::Other, 12, Action::AppendToTagName);
+            SetTransition(Result, 14, CharacterClass::GreaterThan, 0, Action::EmitElementEnd);
+            SetTransition(Result, 14, CharacterClass::Hyphen, 14, Action::AppendToTagName);
+            SetTransition(Result, 14, CharacterClass::Other, 14, Action::AppendToTagName);
+            SetTransition(Result, 15, CharacterClass::Slash, 10, Action::None);
+            SetTransition(Result, 15, CharacterClass::Other, 13, Action::AppendToAttributeName);
+            // attribute identifiers
+            SetTransition(Result, 13, CharacterClass::Whitespace, 16, Action::None);
+            SetTransition(Result, 13, CharacterClass::Equals, 17, Action::None);
+            SetTransition(Result, 13, CharacterClass::Hyphen, 13, Action::AppendToAttributeName);
+            SetTransition(Result, 13, CharacterClass::Other, 13, Action::AppendToAttributeName);
+            SetTransition(Result, 16, CharacterClass::Equals, 17, Action::None);
+            SetTransition(Result, 17, CharacterClass::Whitespace, 18, Action::None);
+            SetTransition(Result, 17, CharacterClass::DoubleQuote, 19, Action::None);
+            SetTransition(Result, 17, CharacterClass::SingleQuote, 21, Action::None);
+            SetTransition(Result, 18, CharacterClass::DoubleQuote, 19, Action::None);
+            SetTransition(Result, 18, CharacterClass::SingleQuote, 21, Action::None);
+            // attribute values
+            for(auto ParsingStage : {19u, 21u})
+            {
+                SetTransitions(Result, ParsingStage, ParsingStage, Action::AppendToAttributeValue);
+                SetTransition(Result, ParsingStage, CharacterClass::LessThan, ParsingStage, Action::None);
+                SetTransition(Result, ParsingStage, CharacterClass::GreaterThan, ParsingStage, Action::None);
+                SetTransition(Result, ParsingStage, CharacterClass::Semicolon, ParsingStage, Action::None);
+                SetTransition(Result, ParsingStage, CharacterClass::Ampersand, ParsingStage + 1, Action::StartEntityInAttributeValue);
+                SetTransition(Result, ParsingStage + 1, CharacterClass::Other, ParsingStage + 1, Action::AppendToEntity);
+                SetTransition(Result, ParsingStage + 1, CharacterClass::Semicolon, ParsingStage, Action::ForwardEntityToAttributeValue);
+            }
+            SetTransition(Result, 19, CharacterClass::DoubleQuote, 8, Action::StoreAttribute);
+            SetTransition(Result, 21, CharacterClass::SingleQuote, 8, Action::StoreAttribute);
+            
+            return Result;
+        }
+
+        inline constexpr auto CharacterClasses = MakeCharacterClasses();
+        inline constexpr auto Transitions = MakeTransitions();
+        
+        /**
+         * The characters that end a run of ordinary characters in the document scope, in a comment
+         * and in attribute values with double and single quotes respectively. Note that '<', '>' and
+         * ';' are dropped from attribute values.
+         **/
+        extern XML::Scanner const TextScanner;
+        extern XML::Scanner const CommentScanner;
+        extern XML::Scanner const DoubleQuotedAttributeValueScanner;
+        extern XML::Scanner const SingleQuotedAttributeValueScanner;
+        
+        inline auto CollectAttributes(std::vector<std::pair<XML::Detail::Token, XML::Detail::Token>> const & Attributes, std::size_t AttributeCount, XML::SymbolTable * SymbolTable, std::vector<XML::Attribute> & AttributeViews) -> void
+        {
+            AttributeViews.clear();
+            for(auto Index = std::size_t{0}; Index < AttributeCount; ++Index)
+            {
+                auto const Name = Attributes[Index].first.View();
+                
+                AttributeViews.push_back(XML::Attribute{Name, Attributes[Index].second.View(), (SymbolTable != nullptr) ? SymbolTable->Intern(Name) : XML::NoSymbol});
+            }
+        }
+
+        /**
+         * Appends what the entity stands for, or the entity itself if it is unknown. Returns whether
+         * the entity was expanded.
+         **/
+        inline auto ForwardEntityTo(std::string & Entity, XML::Detail::Token & To) -> bool
+        {
+            auto Buffer = std::array<char, 4>{};
+            auto const Replacement = XML::Detail::DecodeEntity(Entity, Buffer);
+            auto Result = true;
+            
+            if(Replacement.empty() == false)
+            {
+                To.Append(Replacement);
+            }
+            else
+            {
+                To.Append("&");
+                To.Append(Entity);
+                To.Append(";");
+                Result = false;
+            }
+            Entity.erase();
+            
+            return Result;
+        }
+
+        /**
+         * Appends the dashes that were held back while looking for the end of a comment. They are taken
+         * from the input block if they are right in front of the position, so that the comment can stay
+         * a view. Characters that were dropped after the dashes may stand there instead.
+         **/
+        inline auto ForwardDashesTo(std::size_t Count, char const * BlockBegin, char const * Position, XML::Detail::Token & To) -> void
+        {
+            if((Position - BlockBegin >= static_cast<std::ptrdiff_t>(Count)) && (std::string_view{Position - Count, Count} == std::string_view{"--", Count}))
+            {
+                To.Append(Position - Count, Position);
+            }
+            else
+            {
+                To.Append(std::string_view{"--", Count});
+            }
+        }
+
+        /**
+         * Appends the run of characters up to the next one that the scanner is looking for. None of them
+         * is a line break, so only the column advances.
+         **/
+        inline auto ForwardRunTo(XML::Scanner const & Scanner, char const *& Position, char const * BlockEnd, XML::Detail::Token & To, XML::Location & CurrentLocation) -> void
+        {
+            auto const RunEnd = Scanner.Find(Position, BlockEnd);
+            
+            if(RunEnd != Position)
+            {
+                To.Append(Position, RunEnd);
+                CurrentLocation.Column += RunEnd - Position;
+                Position = RunEnd;
+            }
+        }
+
+        inline auto FindCharacter(char const * Begin, char const * End, char Character) -> char const *
+        {
+            auto const Result = static_cast<char const *>(std::memchr(Begin, Character, End - Begin));
+            
+            return (Result != nullptr) ? Result : End;
+        }
+        
+        /**
+         * Advances the location over a range of characters that may contain line breaks.
+         **/
+        inline auto AdvanceLocation(char const * Begin, char const * End, XML::Location & Location) -> void
+        {
+            for(auto LineBreak = FindCharacter(Begin, End, '\n'); LineBreak != End; LineBreak = FindCharacter(Begin, End, '\n'))
+            {
+                Location.Column = 0;
+                Location.Line += 1;
+                Begin = LineBreak + 1;
+            }
+            Location.Column += End - Begin;
+        }
+        
+        /**
+         * Returns the length of the characters without a UTF-8 sequence that is cut off at their end.
+         **/
+        inline auto CompleteLength(std::string_view Characters) -> std::size_t
+        {
+            for(auto Length = Characters.size(); (Length > 0) && (Characters.size() - Length < 4); --Length)
+            {
+                auto const Byte = static_cast<unsigned char>(Characters[Length - 1]);
+                
+                if((Byte & 0xc0) != 0x80)
+                {
+                    auto const SequenceLength = (Byte >= 0xf0) ? 4u : ((Byte >= 0xe0) ? 3u : ((Byte >= 0xc0) ? 2u : 1u));
+                    
+                    return (Characters.size() - (Length - 1) < SequenceLength) ? (Length - 1) : Characters.size();
+                }
+            }
+            
+            return Characters.size();
+        }
+        
+        /**
+         * How much of a text or comment is delivered in fragments: only full fragments while the
+         * node goes on, everything that is complete at the end of a block, and everything at the
+         * end of the node.
+         **/
+        enum class FragmentEnd : std::uint8_t
+        {
+            Block,
+            None,
+            Node
+        };
+        
+        enum class SkipStage : std::uint8_t
+        {
+            Comment,
+            CommentDash,
+            CommentDashDash,
+            CommentOpening,
+            CommentOpeningDash,
+            Content,
+            DoubleQuoted,
+            EndTag,
+            Markup,
+            SingleQuoted,
+            SlashInStartTag,
+            StartTag
+        };
+        
+        /**
+         * Skips the content of an element without building any tokens. Only the markup is looked at,
+         * to count the depth of the elements inside and to step over comments and attribute values,
+         * which may contain '<' and '>'. Returns true when the end tag of the skipped element is
+         * reached, with the position at the slash after its '<'. Otherwise, the whole block has been
+         * skipped and the stage and depth are kept for the next one.
+         **/
+        inline auto SkipElementContent(XML::Detail::SkipStage & Stage, std::size_t & Depth, char const *& Position, char const * BlockEnd) -> bool
+        {
+            for(; Position != BlockEnd; ++Position)
+            {
+                switch(Stage)
+                {
+                case XML::Detail::SkipStage::Comment:
+                    {
+                        Position = FindCharacter(Position, BlockEnd, '-');
+                        if(Position == BlockEnd)
+                        {
+                            return false;
+                        }
+                        Stage = XML::Detail::SkipStage::CommentDash;
+                        
+                        break;
+                    }
+                case XML::Detail::SkipStage::CommentDash:
+                    {
+                        Stage = (*Position == '-') ? XML::Detail::SkipStage::CommentDashDash : XML::Detail::SkipStage::Comment;
+                        
+                        break;
+                    }
+                case XML::Detail::SkipStage::CommentDashDash:
+                    {
+                        if(*Position == '>')
+                        {
+                            Stage = XML::Detail::SkipStage::Content;
+                        }
+                        else if(*Position != '-')
+                        {
+                            Stage = XML::Detail::SkipStage::Comment;
+                        }
+                        
+                        break;
+                    }
+                case XML::Detail::SkipStage::CommentOpening:
+                    {
+                        Stage = (*Position == '-') ? XML::Detail::SkipStage::CommentOpeningDash : XML::Detail::SkipStage::Comment;
+                        
+                        break;
+                    }
+                case XML::Detail::SkipStage::CommentOpeningDash:
+                    {
+                        // the dashes that open a comment do not count towards the ones that close it
+                        Stage = XML::Detail::SkipStage::Comment;
+                        
+                        break;
+                    }
+                case XML::Detail::SkipStage::Content:
+                    {
+                        Position = FindCharacter(Position, BlockEnd, '<');
+                        if(Position == BlockEnd)
+                        {
+                            return false;
+                        }
+                        Stage = XML::Detail::SkipStage::Markup;
+                        
+                        break;
+                    }
+                case XML::Detail::SkipStage::DoubleQuoted:
+                    {
+                        Position = FindCharacter(Position, BlockEnd, '"');
+                        if(Position == BlockEnd)
+                        {
+                            return false;
+                        }
+                        Stage = XML::Detail::SkipStage::StartTag;
+                        
+                        break;
+                    }
+                case XML::Detail::SkipStage::EndTag:
+                    {
+                        Position = FindCharacter(Position, BlockEnd, '>');
+                        if(Position == BlockEnd)
+                        {
+                            return false;
+                        }
+                        Stage = XML::Detail::SkipStage::Content;
+                        
+                        break;
+                    }
+                case XML::Detail::SkipStage::Markup:
+                    {
+                        if(*Position == '/')
+                        {
+                            if(Depth == 0)
+                            {
+                                return true;
+                            }
+                            Depth -= 1;
+                            Stage = XML::Detail::SkipStage::EndTag;
+                        }
+                        else if(*Position == '!')
+                        {
+                            Stage = XML::Detail::SkipStage::CommentOpening;
+                        }
+                        else
+                        {
+                            Stage = XML::Detail::SkipStage::StartTag;
+                        }
+                        
+                        break;
+                    }
+                case XML::Detail::SkipStage::SingleQuoted:
+                    {
+                        Position = FindCharacter(Position, BlockEnd, '\'');
+                        if(Position == BlockEnd)
+                        {
+                            return false;
+                        }
+                        Stage = XML::Detail::SkipStage::StartTag;
+                        
+                        break;
+                    }
+                case XML::Detail::SkipStage::SlashInStartTag:
+                case XML::Detail::SkipStage::StartTag:
+                    {
+                        if(*Position == '>')
+                        {
+                            // only an element that is not self-closing has content
+                            if(Stage == XML::Detail::SkipStage::StartTag)
+                            {
+                                Depth += 1;
+                            }
+                            Stage = XML::Detail::SkipStage::Content;
+                        }
+                        else if(*Position == '/')
+                        {
+                            Stage = XML::Detail::SkipStage::SlashInStartTag;
+                        }
+                        else if(*Position == '"')
+                        {
+                            Stage = XML::Detail::SkipStage::DoubleQuoted;
+                        }
+                        else if(*Position == '\'')
+                        {
+                            Stage = XML::Detail::SkipStage::SingleQuoted;
+                        }
+                        else
+                        {
+                            Stage = XML::Detail::SkipStage::StartTag;
+                        }
+                        
+                        break;
+                    }
+                }
+            }
+            
+            return false;
+        }
+        
+        /**
+         * Moves the attribute into the element's attribute buffer, which is reused for every element.
+         * If the element already has an attribute with that name, only its value is replaced.
+         **/
+        inline auto StoreAttribute(std::vector<std::pair<XML::Detail::Token, XML::Detail::Token>> & Attributes, std::size_t & AttributeCount, XML::Detail::Token & AttributeName, XML::Detail::Token & AttributeValue) -> void
+        {
+            auto Index = std::size_t{0};
+            
+            while((Index < AttributeCount) && (Attributes[Index].first.View() != AttributeName.View()))
+            {
+                ++Index;
+            }
+            if(Index == AttributeCount)
+            {
+                if(AttributeCount == Attributes.size())
+                {
+                    Attributes.emplace_back();
+                }
+                std::swap(Attributes[AttributeCount].first, AttributeName);
+                ++AttributeCount;
+            }
+            std::swap(Attributes[Index].second, AttributeValue);
+            AttributeName.Clear();
+            AttributeValue.Clear();
+        }
+    }
+    
+    template<typename HandlerType>
+    class ParallelParser;
+    
+    /**
+     * The basic parser calls the member functions of its handler directly, so that they can be
+     * inlined into the parsing loop. A handler may provide any of the following member functions,
+     * those that are missing are not called:
+     * - Comment(std::string_view Comment, XML::Location const & StartLocation)
+     * - ElementStart(XML::Name TagName, XML::Attributes Attributes, XML::Location const & StartLocation)
+     * - ElementEnd(XML::Name TagName)
+     * - Text(std::string_view Text, XML::Location const & StartLocation)
+     * - CommentFragment(std::string_view Fragment, XML::Location const & StartLocation, bool First, bool Last)
+     * - TextFragment(std::string_view Fragment, XML::Location const & StartLocation, bool First, bool Last)
+     * The fragment functions are only called if a fragment size is set, in place of Comment() and
+     * Text(). The views are only valid for the duration of the call. Element and attribute names carry their
+     * ids from the symbol table, if one is set, and XML::NoSymbol otherwise.
+     **/
+    template<typename HandlerType>
+    class BasicParser
+    {
+    public:
+        BasicParser(HandlerType & Handler);
+        BasicParser(HandlerType & Handler, std::istream & InputStream);
+        BasicParser(HandlerType & Handler, std::span<char const> Data);
+        BasicParser(HandlerType & Handler, std::filesystem::path const & Path);
+        BasicParser(HandlerType & Handler, std::unique_ptr<XML::InputSource> InputSource);
+        /**
+         * Parses a chunk of input, which may end anywhere, even inside a name or an entity. The
+         * chunk is not referenced after the call. Finish() ends the input and resets the parser,
+         * so that it can be fed the next document.
+         **/
+        auto Feed(std::span<char const> Chunk) -> void;
+        auto Finish() -> void;
+        /**
+         * Parses the input until it ends or until a handler calls Suspend(). The next call to
+         * Parse() continues where the last one stopped.
+         **/
+        auto Parse() -> void;
+        /**
+         * Prepares the parser for the next document, which is read from the input source and
+         * delivered to the handler. The parser keeps its buffers, so parsing many small documents
+         * with one parser avoids most allocations.
+         **/
+        auto Reset(HandlerType & Handler, std::unique_ptr<XML::InputSource> InputSource) -> void;
+        /**
+         * Entities are decoded by default. Without decoding, texts and attribute values are
+         * delivered with their entities as they appear in the input, so they stay views into the
+         * input even if they contain entities. XML::DecodeEntities() decodes them on demand.
+         **/
+        auto SetDecodeEntities(bool DecodeEntities) -> void;
+        /**
+         * The parser records its elements in the element index, which must outlive the parser, or
+         * be unset by passing nullptr. The offsets are only meaningful if locations are tracked.
+         **/
+        auto SetElementIndex(XML::ElementIndex * ElementIndex) -> void;
+        /**
+         * With a fragment size other than zero, texts and comments are delivered in fragments of at
+         * most that many characters, so that the parser never holds a whole node, however large it
+         * is. A fragment is shorter if the block ends or if it would cut a UTF-8 sequence, and the
+         * last fragment of a node may be empty. Attribute values are still delivered as a whole.
+         **/
+        auto SetFragmentSize(std::size_t FragmentSize) -> void;
+        /**
+         * The parser appends its input to the line index as it reads it, so that the offsets of
+         * the locations can be resolved into lines and columns later on. The line index must
+         * outlive the parser, or be unset by passing nullptr.
+         **/
+        auto SetLineIndex(XML::LineIndex * LineIndex) -> void;
+        /**
+         * Locations have lines, columns and offsets by default.
+         **/
+        auto SetLocationTracking(XML::LocationTracking LocationTracking) -> void;
+        /**
+         * While statistics are set, the parser updates them as it goes. They must outlive the parser,
+         * or be unset by passing nullptr. Without statistics, the parser does not read the clock.
+         **/
+        auto SetStatistics(XML::Statistics * Statistics) -> void;
+        /**
+         * Element and attribute names are interned into the symbol table, which must outlive the
+         * parser. Passing nullptr stops the interning.
+         **/
+        auto SetSymbolTable(XML::SymbolTable * SymbolTable) -> void;
+        /**
+         * Called from ElementStart(), the parser skips the content of the element up to its end tag
+         * without building any names, texts or attributes and without calling the handler.
+         * ElementEnd() is called for the skipped element as usual. Has no effect on self-closing
+         * elements.
+         **/
+        auto SkipElement() -> void;
+        auto Suspend() -> void;
+    private:
+        template<typename>
+        friend class XML::ParallelParser;
+        
+        template<typename CallbackType>
+        auto Call(CallbackType && Callback) -> void;
+        auto DetachTokens() -> void;
+        auto EmitComment(std::string_view Comment, XML::Location const & StartLocation) -> void;
+        auto EmitCommentFragment(std::string_view Fragment, XML::Location const & StartLocation, bool Last) -> void;
+        auto EmitElementEnd(XML::Name TagName) -> void;
+        auto EmitElementStart(XML::Name TagName, XML::Attributes Attributes, XML::Location const & StartLocation) -> void;
+        auto EmitFragments(XML::Detail::Token & Token, bool Comment, XML::Detail::FragmentEnd End) -> void;
+        auto EmitPendingFragments() -> void;
+        auto EmitText(std::string_view Text, XML::Location const & StartLocation) -> void;
+        auto EmitTextFragment(std::string_view Fragment, XML::Location const & StartLocation, bool Last) -> void;
+        template<XML::LocationTracking Tracking>
+        auto MakeLocation(XML::Location const & CurrentLocation, char const * Position) const -> XML::Location;
+        auto MakeName(std::string_view Text) -> XML::Name;
+        auto ParseBlock() -> void;
+        template<XML::LocationTracking Tracking>
+        auto ParseBlock() -> void;
+        
+        std::vector<std::pair<XML::Detail::Token, XML::Detail::Token>> m_Attributes;
+        std::size_t m_AttributeCount;
+        XML::Detail::Token m_AttributeName;
+        XML::Detail::Token m_AttributeValue;
+        std::vector<XML::Attribute> m_AttributeViews;
+        char const * m_BlockBegin;
+        char const * m_BlockEnd;
+        std::uint64_t m_BlockOffset;
+        XML::Detail::Token m_Comment;
+        XML::Location m_CurrentLocation;
+        bool m_DecodeEntities;
+        XML::ElementIndex * m_ElementIndex;
+        std::string m_Entity;
+        std::size_t m_FragmentedSize;
+        std::size_t m_FragmentSize;
+        HandlerType * m_Handler;
+        std::unique_ptr<XML::InputSource> m_InputSource;
+        XML::LineIndex * m_LineIndex;
+        XML::LocationTracking m_LocationTracking;
+        unsigned int m_ParsingStage;
+        char const * m_Position;
+        std::size_t m_SkipDepth;
+        std::optional<XML::Detail::SkipStage> m_SkipStage;
+        std::optional<XML::Location> m_StartLocation;
+        XML::Statistics * m_Statistics;
+        bool m_Suspended;
+        XML::SymbolTable * m_SymbolTable;
+        XML::Detail::Token m_TagName;
+        XML::Detail::Token m_Text;
+    };
+}
+
+template<typename HandlerType>
+XML::BasicParser<HandlerType>::BasicParser(HandlerType & Handler) :
+    BasicParser{Handler, std::unique_ptr<XML::InputSource>{}}
+{
+}
+
+template<typename HandlerType>
+XML::BasicParser<HandlerType>::BasicParser(HandlerType & Handler, std::istream & InputStream) :
+    BasicParser{Handler, std::make_unique<XML::StreamInputSource>(InputStream)}
+{
+}
+
+template<typename HandlerType>
+XML::BasicParser<HandlerType>::BasicParser(HandlerType & Handler, std::span<char const> Data) :
+    BasicParser{Handler, std::make_unique<XML::MemoryInputSource>(Data)}
+{
+}
+
+template<typename HandlerType>
+XML::BasicParser<HandlerType>::BasicParser(HandlerType & Handler, std::filesystem::path const & Path) :
+    BasicParser{Handler, std::make_unique<XML::MappedFileInputSource>(Path)}
+{
+}
+
+template<typename HandlerType>
+XML::BasicParser<HandlerType>::BasicParser(HandlerType & Handler, std::unique_ptr<XML::InputSource> InputSource) :
+    m_AttributeCount{0},
+    m_BlockBegin{nullptr},
+    m_BlockEnd{nullptr},
+    m_BlockOffset{0},
+    m_CurrentLocation{0, 0, 0},
+    m_DecodeEntities{true},
+    m_ElementIndex{nullptr},
+    m_FragmentedSize{0},
+    m_FragmentSize{0},
+    m_Handler{&Handler},
+    m_InputSource{std::move(InputSource)},
+    m_LineIndex{nullptr},
+    m_LocationTracking{XML::LocationTracking::LinesAndColumns},
+    m_ParsingStage{0},
+    m_Position{nullptr},
+    m_SkipDepth{0},
+    m_Statistics{nullptr},
+    m_Suspended{false},
+    m_SymbolTable{nullptr}
+{
+}
+
+template<typename HandlerType>
+auto XML::BasicParser<HandlerType>::Feed(std::span<char const> Chunk) -> void
+{
+    // a block that Parse() has finished before still counts towards the offsets
+    m_BlockOffset += m_BlockEnd - m_BlockBegin;
+    m_BlockBegin = Chunk.data();
+    m_BlockEnd = Chunk.data() + Chunk.size();
+    m_Position = m_BlockBegin;
+    if(m_LineIndex != nullptr)
+    {
+        m_LineIndex->Append(Chunk);
+    }
+    while(m_Position != m_BlockEnd)
+    {
+        m_Suspended = false;
+        ParseBlock();
+    }
+    EmitPendingFragments();
+    // the caller may reuse the chunk's memory after this call
+    DetachTokens();
+    m_BlockOffset += Chunk.size();
+    m_BlockBegin = nullptr;
+    m_BlockEnd = nullptr;
+    m_Position = nullptr;
+}
+
+template<typename HandlerType>
+auto XML::BasicParser<HandlerType>::Finish() -> void
+{
+    // the tokens keep their storage for the next document
+    m_AttributeCount = 0;
+    m_AttributeName.Clear();
+    m_AttributeValue.Clear();
+    m_BlockBegin = nullptr;
+    m_BlockEnd = nullptr;
+    m_BlockOffset = 0;
+    m_Comment.Clear();
+    m_CurrentLocation = XML::Location{0, 0, 0};
+    m_Entity.clear();
+    m_FragmentedSize = 0;
+    m_ParsingStage = 0;
+    m_Position = nullptr;
+    m_SkipStage.reset();
+    m_StartLocation.reset();
+    m_Suspended = false;
+    m_TagName.Clear();
+    m_Text.Clear();
+}
+
+template<typename HandlerType>
+auto XML::BasicParser<HandlerType>::Parse() -> void
+{
+    assert(m_InputSource != nullptr);
+    m_Suspended = false;
+    while(m_Suspended == false)
+    {
+        if(m_Position == m_BlockEnd)
+        {
+            EmitPendingFragments();
+            // reading the next block may invalidate the current one
+            DetachTokens();
+            
+            auto const Block = m_InputSource->Read();
+            
+            if(Block.empty() == true)
+            {
+                break;
+            }
+            m_BlockOffset += m_BlockEnd - m_BlockBegin;
+            if(m_LineIndex != nullptr)
+            {
+                m_LineIndex->Append(Block);
+            }
+            m_BlockBegin = Block.data();
+            m_BlockEnd = Block.data() + Block.size();
+            m_Position = m_BlockBegin;
+        }
+        ParseBlock();
+    }
+}
+
+template<typename HandlerType>
+auto XML::BasicParser<HandlerType>::Reset(HandlerType & Handler, std::unique_ptr<XML::InputSource> InputSource) -> void
+{
+    Finish();
+    m_Handler = &Handler;
+    m_InputSource = std::move(InputSource);
+}
+
+template<typename HandlerType>
+auto XML::BasicParser<HandlerType>::SetDecodeEntities(bool DecodeEntities) -> void
+{
+    m_DecodeEntities = DecodeEntities;
+}
+
+template<typename HandlerType>
+auto XML::BasicParser<HandlerType>::SetElementIndex(XML::ElementIndex * ElementIndex) -> void
+{
+    m_ElementIndex = ElementIndex;
+}
+
+template<typename HandlerType>
+auto XML::BasicParser<HandlerType>::SetFragmentSize(std::size_t FragmentSize) -> void
+{
+    m_FragmentSize = FragmentSize;
+}
+
+template<typename HandlerType>
+auto XML::BasicParser<HandlerType>::SetLineIndex(XML::LineIndex * LineIndex) -> void
+{
+    m_LineIndex = LineIndex;
+}
+
+template<typename HandlerType>
+auto XML::BasicParser<HandlerType>::SetLocationTracking(XML::LocationTracking LocationTracking) -> void
+{
+    m_LocationTracking = LocationTracking;
+}
+
+template<typename HandlerType>
+auto XML::BasicParser<HandlerType>::SetStatistics(XML::Statistics * Statistics) -> void
+{
+    m_Statistics = Statistics;
+}
+
+template<typename HandlerType>
+auto XML::BasicParser<HandlerType>::SetSymbolTable(XML::SymbolTable * SymbolTable) -> void
+{
+    m_SymbolTable = SymbolTable;
+}
+
+template<typename HandlerType>
+auto XML::BasicParser<HandlerType>::SkipElement() -> void
+{
+    m_SkipDepth = 0;
+    m_SkipStage = XML::Detail::SkipStage::Content;
+}
+
+template<typename HandlerType>
+auto XML::BasicParser<HandlerType>::Suspend() -> void
+{
+    m_Suspended = true;
+}
+
+/**
+ * Calls the handler, measuring the time spent in it if statistics are set.
+ **/
+template<typename HandlerType>
+template<typename CallbackType>
+auto XML::BasicParser<HandlerType>::Call(CallbackType && Callback) -> void
+{
+    if(m_Statistics != nullptr)
+    {
+        auto const Start = std::chrono::steady_clock::now();
+        
+        Callback();
+        m_Statistics->CallbackDuration += std::chrono::steady_clock::now() - Start;
+    }
+    else
+    {
+        Callback();
+    }
+}
+
+/**
+ * Makes all tokens take a copy of the characters they refer to, before the current block becomes
+ * invalid.
+ **/
+template<typename HandlerType>
+auto XML::BasicParser<HandlerType>::DetachTokens() -> void
+{
+    for(auto Index = std::size_t{0}; Index < m_AttributeCount; ++Index)
+    {
+        m_Attributes[Index].first.Detach();
+        m_Attributes[Index].second.Detach();
+    }
+    m_AttributeName.Detach();
+    m_AttributeValue.Detach();
+    m_Comment.Detach();
+    m_TagName.Detach();
+    m_Text.Detach();
+}
+
+template<typename HandlerType>
+auto XML::BasicParser<HandlerType>::EmitComment([[maybe_unused]] std::string_view Comment, [[maybe_unused]] XML::Location const & StartLocation) -> void
+{
+    if(m_Statistics != nullptr)
+    {
+        m_Statistics->CommentCount += 1;
+    }
+    if constexpr(requires { m_Handler->Comment(Comment, StartLocation); })
+    {
+        Call([&]() { m_Handler->Comment(Comment, StartLocation); });
+    }
+}
+
+template<typename HandlerType>
+auto XML::BasicParser<HandlerType>::EmitCommentFragment([[maybe_unused]] std::string_view Fragment, [[maybe_unused]] XML::Location const & StartLocation, bool Last) -> void
+{
+    [[maybe_unused]] auto const First = (m_FragmentedSize == 0);
+    
+    m_FragmentedSize += Fragment.size();
+    if((m_Statistics != nullptr) && (Last == true))
+    {
+        m_Statistics->CommentCount += 1;
+    }
+    if constexpr(requires { m_Handler->CommentFragment(Fragment, StartLocation, First, Last); })
+    {
+        Call([&]() { m_Handler->CommentFragment(Fragment, StartLocation, First, Last); });
+    }
+    if(Last == true)
+    {
+        m_FragmentedSize = 0;
+    }
+}
+
+template<typename HandlerType>
+auto XML::BasicParser<HandlerType>::EmitElementEnd([[maybe_unused]] XML::Name TagName) -> void
+{
+    if(m_Statistics != nullptr)
+    {
+        m_Statistics->ElementEndCount += 1;
+        if(m_Statistics->Depth > 0)
+        {
+            m_Statistics->Depth -= 1;
+        }
+    }
+    if(m_ElementIndex != nullptr)
+    {
+        m_ElementIndex->ElementEnd();
+    }
+    if constexpr(requires { m_Handler->ElementEnd(TagName); })
+    {
+        Call([&]() { m_Handler->ElementEnd(TagName); });
+    }
+}
+
+template<typename HandlerType>
+auto XML::BasicParser<HandlerType>::EmitElementStart([[maybe_unused]] XML::Name TagName, [[maybe_unused]] XML::Attributes Attributes, [[maybe_unused]] XML::Location const & StartLocation) -> void
+{
+    if(m_Statistics != nullptr)
+    {
+        m_Statistics->ElementStartCount += 1;
+        m_Statistics->Depth += 1;
+        m_Statistics->MaximumDepth = std::max(m_Statistics->MaximumDepth, m_Statistics->Depth);
+        for(auto const & Attribute : Attributes)
+        {
+            m_Statistics->MaximumAttributeValueSize = std::max(m_Statistics->MaximumAttributeValueSize, Attribute.Value.size());
+        }
+    }
+    if(m_ElementIndex != nullptr)
+    {
+        m_ElementIndex->ElementStart(TagName, StartLocation.Offset);
+    }
+    if constexpr(requires { m_Handler->ElementStart(TagName, Attributes, StartLocation); })
+    {
+        Call([&]() { m_Handler->ElementStart(TagName, Attributes, StartLocation); });
+    }
+}
+
+/**
+ * Delivers the characters of a text or comment that the token has collected in fragments of at
+ * most the fragment size. Until the end of the block or of the node, the characters that do not
+ * fill a fragment stay in the token. At the end of a block, they are delivered as well, so that
+ * they never have to be copied, except for a UTF-8 sequence that the block cuts off.
+ **/
+template<typename HandlerType>
+auto XML::BasicParser<HandlerType>::EmitFragments(XML::Detail::Token & Token, bool Comment, XML::Detail::FragmentEnd End) -> void
+{
+    assert(m_StartLocation.has_value() == true);
+    
+    auto const Characters = Token.View();
+    auto Begin = std::size_t{0};
+    auto const Emit = [&](std::size_t Length, bool Last)
+    {
+        if(Comment == true)
+        {
+            EmitCommentFragment(Characters.substr(Begin, Length), m_StartLocation.value(), Last);
+        }
+        else
+        {
+            EmitTextFragment(Characters.substr(Begin, Length), m_StartLocation.value(), Last);
+        }
+        Begin += Length;
+    };
+    
+    while(Characters.size() - Begin > m_FragmentSize)
+    {
+        auto const Length = XML::Detail::CompleteLength(Characters.substr(Begin, m_FragmentSize));
+        
+        // a fragment size below the length of a UTF-8 sequence wins over the sequence
+        Emit((Length > 0) ? Length : m_FragmentSize, false);
+    }
+    if(End == XML::Detail::FragmentEnd::Node)
+    {
+        Emit(Characters.size() - Begin, true);
+        Token.Clear();
+    }
+    else
+    {
+        if(End == XML::Detail::FragmentEnd::Block)
+        {
+            auto const Length = XML::Detail::CompleteLength(Characters.substr(Begin));
+            
+            if(Length > 0)
+            {
+                Emit(Length, false);
+            }
+        }
+        Token.RemovePrefix(Begin);
+    }
+}
+
+/**
+ * Delivers what the text or comment at the end of the block has collected, before the block
+ * becomes invalid.
+ **/
+template<typename HandlerType>
+auto XML::BasicParser<HandlerType>::EmitPendingFragments() -> void
+{
+    if(m_FragmentSize != 0)
+    {
+        if(m_Text.Empty() == false)
+        {
+            EmitFragments(m_Text, false, XML::Detail::FragmentEnd::Block);
+        }
+        if(m_Comment.Empty() == false)
+        {
+            EmitFragments(m_Comment, true, XML::Detail::FragmentEnd::Block);
+        }
+    }
+}
+
+template<typename HandlerType>
+auto XML::BasicParser<HandlerType>::EmitText([[maybe_unused]] std::string_view Text, [[maybe_unused]] XML::Location const & StartLocation) -> void
+{
+    if(m_Statistics != nullptr)
+    {
+        m_Statistics->TextCount += 1;
+        m_Statistics->MaximumTextSize = std::max(m_Statistics->MaximumTextSize, Text.size());
+    }
+    if constexpr(requires { m_Handler->Text(Text, StartLocation); })
+    {
+        Call([&]() { m_Handler->Text(Text, StartLocation); });
+    }
+}
+
+template<typename HandlerType>
+auto XML::BasicParser<HandlerType>::EmitTextFragment([[maybe_unused]] std::string_view Fragment, [[maybe_unused]] XML::Location const & StartLocation, bool Last) -> void
+{
+    [[maybe_unused]] auto const First = (m_FragmentedSize == 0);
+    
+    m_FragmentedSize += Fragment.size();
+    if((m_Statistics != nullptr) && (Last == true))
+    {
+        m_Statistics->TextCount += 1;
+        m_Statistics->MaximumTextSize = std::max(m_Statistics->MaximumTextSize, m_FragmentedSize);
+    }
+    if constexpr(requires { m_Handler->TextFragment(Fragment, StartLocation, First, Last); })
+    {
+        Call([&]() { m_Handler->TextFragment(Fragment, StartLocation, First, Last); });
+    }
+    if(Last == true)
+    {
+        m_FragmentedSize = 0;
+    }
+}
+
+template<typename HandlerType>
+template<XML::LocationTracking Tracking>
+auto XML::BasicParser<HandlerType>::MakeLocation(XML::Location const & CurrentLocation, char const * Position) const -> XML::Location
+{
+    if constexpr(Tracking == XML::LocationTracking::LinesAndColumns)
+    {
+        return XML::Location{CurrentLocation.Column, CurrentLocation.Line, m_BlockOffset + (Position - m_BlockBegin)};
+    }
+    else if constexpr(Tracking == XML::LocationTracking::Offsets)
+    {
+        return XML::Location{0, 0, m_BlockOffset + (Position - m_BlockBegin)};
+    }
+    else
+    {
+        return XML::Location{0, 0, 0};
+    }
+}
+
+template<typename HandlerType>
+auto XML::BasicParser<HandlerType>::MakeName(std::string_view Text) -> XML::Name
+{
+    if(m_SymbolTable != nullptr)
+    {
+        return XML::Name{Text, m_SymbolTable->Intern(Text)};
+    }
+    else
+    {
+        return XML::Name{Text, XML::NoSymbol};
+    }
+}
+
+template<typename HandlerType>
+auto XML::BasicParser<HandlerType>::ParseBlock() -> void
+{
+    switch(m_LocationTracking)
+    {
+    case XML::LocationTracking::LinesAndColumns:
+        {
+            ParseBlock<XML::LocationTracking::LinesAndColumns>();
+            
+            break;
+        }
+    case XML::LocationTracking::None:
+        {
+            ParseBlock<XML::LocationTracking::None>();
+            
+            break;
+        }
+    case XML::LocationTracking::Offsets:
+        {
+            ParseBlock<XML::LocationTracking::Offsets>();
+            
+            break;
+        }
+    }
+}
+
+/**
+ * The parser is instantiated for every kind of location tracking, so that tracking lines and
+ * columns for every byte only costs where it is wanted.
+ **/
+template<typename HandlerType>
+template<XML::LocationTracking Tracking>
+auto XML::BasicParser<HandlerType>::ParseBlock() -> void
+{
+    auto const BlockBegin = m_BlockBegin;
+    auto const BlockEnd = m_BlockEnd;
+    auto Position = m_Position;
+    auto ParsingStage = m_ParsingStage;
+    auto CurrentLocation = m_CurrentLocation;
+    auto const Start = (m_Statistics != nullptr) ? std::chrono::steady_clock::now() : std::chrono::steady_clock::time_point{};
+    
+    for(; (Position != BlockEnd) && (m_Suspended == false); ++Position)
+    {
+        if(m_SkipStage.has_value() == true)
+        {
+            auto const SkipBegin = Position;
+            auto const EndTagReached = XML::Detail::SkipElementContent(m_SkipStage.value(), m_SkipDepth, Position, BlockEnd);
+            
+            if constexpr(Tracking == XML::LocationTracking::LinesAndColumns)
+            {
+                XML::Detail::AdvanceLocation(SkipBegin, Position, CurrentLocation);
+            }
+            if(EndTagReached == false)
+            {
+                break;
+            }
+            // the end tag is parsed as usual, starting with the slash after its '<'
+            m_SkipStage.reset();
+            ParsingStage = 1;
+        }
+        if(ParsingStage == 0)
+        {
+            if((m_StartLocation.has_value() == false) && (*Position != '<'))
+            {
+                m_StartLocation = MakeLocation<Tracking>(CurrentLocation, Position);
+            }
+            XML::Detail::ForwardRunTo(XML::Detail::TextScanner, Position, BlockEnd, m_Text, CurrentLocation);
+            if((m_FragmentSize != 0) && (m_Text.View().size() > m_FragmentSize))
+            {
+                EmitFragments(m_Text, false, XML::Detail::FragmentEnd::None);
+            }
+        }
+        else if(ParsingStage == 4)
+        {
+            XML::Detail::ForwardRunTo(XML::Detail::CommentScanner, Position, BlockEnd, m_Comment, CurrentLocation);
+            if((m_FragmentSize != 0) && (m_Comment.View().size() > m_FragmentSize))
+            {
+                EmitFragments(m_Comment, true, XML::Detail::FragmentEnd::None);
+            }
+        }
+        else if(ParsingStage == 19)
+        {
+            XML::Detail::ForwardRunTo(XML::Detail::DoubleQuotedAttributeValueScanner, Position, BlockEnd, m_AttributeValue, CurrentLocation);
+        }
+        else if(ParsingStage == 21)
+        {
+            XML::Detail::ForwardRunTo(XML::Detail::SingleQuotedAttributeValueScanner, Position, BlockEnd, m_AttributeValue, CurrentLocation);
+        }
+        if(Position == BlockEnd)
+        {
+            break;
+        }
+        
+        auto const Character = *Position;
+        
+        auto const Transition = XML::Detail::Transitions[ParsingStage][static_cast<std::size_t>(XML::Detail::CharacterClasses[static_cast<unsigned char>(Character)])];
+        
+        switch(Transition.Action)
+        {
+        case XML::Detail::Action::None:
+            {
+                break;
+            }
+        case XML::Detail::Action::AppendToAttributeName:
+            {
+                m_AttributeName.Append(Position, Position + 1);
+                
+                break;
+            }
+        case XML::Detail::Action::AppendToAttributeValue:
+            {
+                m_AttributeValue.Append(Position, Position + 1);
+                
+                break;
+            }
+        case XML::Detail::Action::AppendToComment:
+            {
+                m_Comment.Append(Position, Position + 1);
+                
+                break;
+            }
+        case XML::Detail::Action::AppendToCommentAfterDash:
+            {
+                XML::Detail::ForwardDashesTo(1, BlockBegin, Position, m_Comment);
+                m_Comment.Append(Position, Position + 1);
+                
+                break;
+            }
+        case XML::Detail::Action::AppendToCommentAfterTwoDashes:
+            {
+                XML::Detail::ForwardDashesTo(2, BlockBegin, Position, m_Comment);
+                m_Comment.Append(Position, Position + 1);
+                
+                break;
+            }
+        case XML::Detail::Action::AppendToEntity:
+            {
+                if(m_DecodeEntities == true)
+                {
+                    m_Entity += Character;
+                }
+                else if(ParsingStage == 7)
+                {
+                    m_Text.Append(Position, Position + 1);
+                }
+                else
+                {
+                    m_AttributeValue.Append(Position, Position + 1);
+                }
+                
+                break;
+            }
+        case XML::Detail::Action::AppendToTagName:
+            {
+                m_TagName.Append(Position, Position + 1);
+                
+                break;
+            }
+        case XML::Detail::Action::AppendToText:
+            {
+                if(m_StartLocation.has_value() == false)
+                {
+                    m_StartLocation = MakeLocation<Tracking>(CurrentLocation, Position);
+                }
+                m_Text.Append(Position, Position + 1);
+                
+                break;
+            }
+        case XML::Detail::Action::EmitComment:
+            {
+                assert(m_StartLocation.has_value() == true);
+                if(m_FragmentSize != 0)
+                {
+                    EmitFragments(m_Comment, true, XML::Detail::FragmentEnd::Node);
+                }
+                else
+                {
+                    EmitComment(m_Comment.View(), m_StartLocation.value());
+                    m_Comment.Clear();
+                }
+                m_StartLocation.reset();
+                
+                break;
+            }
+        case XML::Detail::Action::EmitElementEnd:
+            {
+                EmitElementEnd(MakeName(m_TagName.View()));
+                m_TagName.Clear();
+                
+                break;
+            }
+        case XML::Detail::Action::EmitElementStart:
+            {
+                assert(m_StartLocation.has_value() == true);
+                XML::Detail::CollectAttributes(m_Attributes, m_AttributeCount, m_SymbolTable, m_AttributeViews);
+                EmitElementStart(MakeName(m_TagName.View()), XML::Attributes{m_AttributeViews}, m_StartLocation.value());
+                m_TagName.Clear();
+                m_AttributeCount = 0;
+                m_StartLocation.reset();
+                
+                break;
+            }
+        case XML::Detail::Action::EmitElementStartAndEnd:
+            {
+                assert(m_StartLocation.has_value() == true);
+                
+                auto const TagName = MakeName(m_TagName.View());
+                
+                XML::Detail::CollectAttributes(m_Attributes, m_AttributeCount, m_SymbolTable, m_AttributeViews);
+                EmitElementStart(TagName, XML::Attributes{m_AttributeViews}, m_StartLocation.value());
+                // a self-closing element has no content to skip
+                m_SkipStage.reset();
+                EmitElementEnd(TagName);
+                m_TagName.Clear();
+                m_AttributeCount = 0;
+                m_StartLocation.reset();
+                
+                break;
+            }
+        case XML::Detail::Action::EmitText:
+            {
+                if((m_Text.Empty() == false) || (m_FragmentedSize != 0))
+                {
+                    assert(m_StartLocation.has_value() == true);
+                    if(m_FragmentSize != 0)
+                    {
+                        EmitFragments(m_Text, false, XML::Detail::FragmentEnd::Node);
+                    }
+                    else
+                    {
+                        EmitText(m_Text.View(), m_StartLocation.value());
+                        m_Text.Clear();
+                    }
+                }
+                m_StartLocation = MakeLocation<Tracking>(CurrentLocation, Position);
+                
+                break;
+            }
+        case XML::Detail::Action::ForwardEntityToAttributeValue:
+            {
+                if(m_DecodeEntities == false)
+                {
+                    m_AttributeValue.Append(Position, Position + 1);
+                }
+                else if((XML::Detail::ForwardEntityTo(m_Entity, m_AttributeValue) == true) && (m_Statistics != nullptr))
+                {
+                    m_Statistics->EntityExpansionCount += 1;
+                }
+                
+                break;
+            }
+        case XML::Detail::Action::ForwardEntityToText:
+            {
+                if(m_DecodeEntities == false)
+                {
+                    m_Text.Append(Position, Position + 1);
+                }
+                else if((XML::Detail::ForwardEntityTo(m_Entity, m_Text) == true) && (m_Statistics != nullptr))
+                {
+                    m_Statistics->EntityExpansionCount += 1;
+                }
+                
+                break;
+            }
+        case XML::Detail::Action::ForwardHeldDashToComment:
+            {
+                // a character that was dropped after the dashes may stand in front of this one
+                if((Position - BlockBegin >= 2) && (*(Position - 2) == '-'))
+                {
+                    m_Comment.Append(Position - 2, Position - 1);
+                }
+                else
+                {
+                    m_Comment.Append("-");
+                }
+                
+                break;
+            }
+        case XML::Detail::Action::ResetStartLocation:
+            {
+                m_StartLocation.reset();
+                
+                break;
+            }
+        case XML::Detail::Action::StartEntityInAttributeValue:
+            {
+                if(m_DecodeEntities == false)
+                {
+                    m_AttributeValue.Append(Position, Position + 1);
+                }
+                
+                break;
+            }
+        case XML::Detail::Action::StartEntityInText:
+            {
+                if(m_StartLocation.has_value() == false)
+                {
+                    m_StartLocation = MakeLocation<Tracking>(CurrentLocation, Position);
+                }
+                if(m_DecodeEntities == false)
+                {
+                    m_Text.Append(Position, Position + 1);
+                }
+                
+                break;
+            }
+        case XML::Detail::Action::StoreAttribute:
+            {
+                XML::Detail::StoreAttribute(m_Attributes, m_AttributeCount, m_AttributeName, m_AttributeValue);
+                
+                break;
+            }
+        }
+        ParsingStage = Transition.NextParsingStage;
+        if constexpr(Tracking == XML::LocationTracking::LinesAndColumns)
+        {
+            if(Character == '\n')
+            {
+                CurrentLocation.Column = 0;
+                CurrentLocation.Line += 1;
+            }
+            else
+            {
+                CurrentLocation.Column += 1;
+            }
+        }
+    }
+    if(m_Statistics != nullptr)
+    {
+        m_Statistics->BytesConsumed += Position - m_Position;
+        m_Statistics->ParseDuration += std::chrono::steady_clock::now() - Start;
+    }
+    CurrentLocation.Offset = m_BlockOffset + (Position - BlockBegin);
+    m_Position = Position;
+    m_ParsingStage = ParsingStage;
+    m_CurrentLocation = CurrentLocation;
+}
+
+#endif
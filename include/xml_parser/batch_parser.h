@@ -0,0 +1,193 @@
+/**
+ * Copyright 2026 Hagen Möbius
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+**/
+
+#ifndef XML_PARSER__BATCH_PARSER_H
+#define XML_PARSER__BATCH_PARSER_H
+
+#include <algorithm>
+#include <cstddef>
+#include <exception>
+#include <filesystem>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <span>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+#include <xml_parser/basic_parser.h>
+#include <xml_parser/input_source.h>
+
+namespace XML
+{
+    namespace Detail
+    {
+        /**
+         * Reads the whole file into the buffer, which keeps its capacity for the next file.
+         **/
+        auto ReadFile(std::filesystem::path const & Path, std::vector<char> & Buffer) -> std::span<char const>;
+        
+        /**
+         * Hands out the indices from zero to Count. Every worker starts with its own contiguous range,
+         * which it processes front to back. A worker whose range is exhausted steals the last index of
+         * another worker's range, so that a few large documents do not hold up the batch.
+         **/
+        class WorkRanges
+        {
+        public:
+            WorkRanges(std::size_t Count, unsigned int WorkerCount);
+            auto Pop(unsigned int WorkerIndex) -> std::optional<std::size_t>;
+        private:
+            class Range
+            {
+            public:
+                std::size_t Begin;
+                std::size_t End;
+                std::mutex Mutex;
+            };
+            
+            std::unique_ptr<Range[]> m_Ranges;
+            unsigned int m_WorkerCount;
+        };
+    }
+    
+    /**
+     * The result of one document of a batch: the handler that received its events and, if parsing
+     * failed, the exception.
+     **/
+    template<typename HandlerType>
+    class BatchResult
+    {
+    public:
+        std::exception_ptr Exception;
+        std::optional<HandlerType> Handler;
+    };
+    
+    /**
+     * The batch parser parses many documents at the same time on a pool of threads. For every
+     * document, the handler factory is called with the document's index and returns the handler
+     * that receives the document's events. As it is called from several threads, the factory must
+     * be thread-safe. Every thread keeps one XML::BasicParser and one file buffer, which it reuses
+     * for all its documents. The results are returned in the order of the inputs.
+     **/
+    template<typename HandlerFactoryType>
+    class BatchParser
+    {
+    public:
+        using HandlerType = std::invoke_result_t<HandlerFactoryType &, std::size_t>;
+        
+        BatchParser(HandlerFactoryType HandlerFactory, unsigned int ThreadCount = std::thread::hardware_concurrency());
+        auto Parse(std::span<std::filesystem::path const> Paths) -> std::vector<XML::BatchResult<HandlerType>>;
+        auto Parse(std::span<std::span<char const> const> Documents) -> std::vector<XML::BatchResult<HandlerType>>;
+    private:
+        template<typename InputType>
+        auto ParseInputs(std::span<InputType const> Inputs) -> std::vector<XML::BatchResult<HandlerType>>;
+        
+        HandlerFactoryType m_HandlerFactory;
+        unsigned int m_ThreadCount;
+    };
+}
+
+template<typename HandlerFactoryType>
+XML::BatchParser<HandlerFactoryType>::BatchParser(HandlerFactoryType HandlerFactory, unsigned int ThreadCount) :
+    m_HandlerFactory{std::move(HandlerFactory)},
+    m_ThreadCount{std::max(ThreadCount, 1u)}
+{
+}
+
+template<typename HandlerFactoryType>
+auto XML::BatchParser<HandlerFactoryType>::Parse(std::span<std::filesystem::path const> Paths) -> std::vector<XML::BatchResult<HandlerType>>
+{
+    return ParseInputs(Paths);
+}
+
+template<typename HandlerFactoryType>
+auto XML::BatchParser<HandlerFactoryType>::Parse(std::span<std::span<char const> const> Documents) -> std::vector<XML::BatchResult<HandlerType>>
+{
+    return ParseInputs(Documents);
+}
+
+template<typename HandlerFactoryType>
+template<typename InputType>
+auto XML::BatchParser<HandlerFactoryType>::ParseInputs(std::span<InputType const> Inputs) -> std::vector<XML::BatchResult<HandlerType>>
+{
+    auto Results = std::vector<XML::BatchResult<HandlerType>>(Inputs.size());
+    auto const ThreadCount = static_cast<unsigned int>(std::clamp(Inputs.size(), std::size_t{1}, static_cast<std::size_t>(m_ThreadCount)));
+    auto WorkRanges = XML::Detail::WorkRanges{Inputs.size(), ThreadCount};
+    auto Work = [this, &Inputs, &Results, &WorkRanges](unsigned int WorkerIndex)
+    {
+        auto Buffer = std::vector<char>{};
+        auto Parser = std::optional<XML::BasicParser<HandlerType>>{};
+        
+        while(auto const Index = WorkRanges.Pop(WorkerIndex))
+        {
+            auto & Result = Results[*Index];
+            
+            try
+            {
+                auto & Handler = Result.Handler.emplace(m_HandlerFactory(*Index));
+                auto InputSource = std::unique_ptr<XML::InputSource>{};
+                
+                if constexpr(std::is_same_v<InputType, std::filesystem::path> == true)
+                {
+                    InputSource = std::make_unique<XML::MemoryInputSource>(XML::Detail::ReadFile(Inputs[*Index], Buffer));
+                }
+                else
+                {
+                    InputSource = std::make_unique<XML::MemoryInputSource>(Inputs[*Index]);
+                }
+                if(Parser.has_value() == false)
+                {
+                    Parser.emplace(Handler, std::move(InputSource));
+                }
+                else
+                {
+                    Parser->Reset(Handler, std::move(InputSource));
+                }
+                Parser->Parse();
+            }
+            catch(...)
+            {
+                Result.Exception = std::current_exception();
+            }
+        }
+    };
+    
+    if(ThreadCount == 1)
+    {
+        Work(0);
+    }
+    else
+    {
+        auto Threads = std::vector<std::jthread>{};
+        
+        for(auto WorkerIndex = 0u; WorkerIndex < ThreadCount; ++WorkerIndex)
+        {
+            Threads.emplace_back(Work, WorkerIndex);
+        }
+    }
+    
+    return Results;
+}
+
+#endif
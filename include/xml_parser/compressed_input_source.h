@@ -0,0 +1,78 @@
+/**
+ * Copyright 2026 Hagen Möbius
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+**/
+
+
+#ifndef XML_PARSER__COMPRESSED_INPUT_SOURCE_H
+#define XML_PARSER__COMPRESSED_INPUT_SOURCE_H
+
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <filesystem>
+#include <mutex>
+#include <span>
+#include <thread>
+#include <vector>
+
+#include <xml_parser/input_source.h>
+
+namespace XML
+{
+    /**
+     * Reads a gzip or zlib compressed file, also one of several concatenated gzip members. A
+     * thread of its own decompresses the mapped file into a ring of blocks, ahead of the parser,
+     * and Read() hands out the filled blocks without copying them. A block is given back to the
+     * ring with the next call to Read().
+     **/
+    class CompressedFileInputSource : public XML::InputSource
+    {
+    public:
+        /**
+         * Throws std::runtime_error if the file cannot be read, and std::invalid_argument if the
+         * block size is zero or there are less than two blocks. Errors in the compressed data are thrown from
+         * Read(), after the blocks in front of them were delivered.
+         **/
+        CompressedFileInputSource(std::filesystem::path const & Path, std::size_t BlockSize = 1024 * 1024, std::size_t BlockCount = 4);
+        CompressedFileInputSource(XML::CompressedFileInputSource const &) = delete;
+        ~CompressedFileInputSource() override;
+        auto operator=(XML::CompressedFileInputSource const &) -> XML::CompressedFileInputSource & = delete;
+        auto Read() -> std::span<char const> override;
+    private:
+        auto Decompress() -> void;
+        
+        std::vector<std::size_t> m_BlockSizes;
+        std::vector<std::vector<char>> m_Blocks;
+        std::condition_variable m_Changed;
+        std::exception_ptr m_Exception;
+        XML::MappedFileInputSource m_File;
+        std::uint64_t m_FilledCount;
+        bool m_Finished;
+        std::mutex m_Mutex;
+        std::filesystem::path m_Path;
+        std::uint64_t m_ReadCount;
+        bool m_Stopping;
+        std::thread m_Thread;
+    };
+}
+
+#endif
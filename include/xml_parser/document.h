@@ -0,0 +1,150 @@
+/**
+ * Copyright 2026 Hagen Möbius
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+**/
+
+
+#ifndef XML_PARSER__DOCUMENT_H
+#define XML_PARSER__DOCUMENT_H
+
+#include <cstdint>
+#include <filesystem>
+#include <istream>
+#include <memory>
+#include <optional>
+#include <span>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include <xml_parser/input_source.h>
+#include <xml_parser/parser.h>
+
+namespace XML
+{
+    class Document;
+    class DocumentBuilder;
+    
+    enum class NodeKind : std::uint8_t
+    {
+        Comment,
+        Document,
+        Element,
+        Text
+    };
+    
+    /**
+     * A node is a lightweight handle to a node in a document. It is only valid as long as the
+     * document is neither cleared nor destroyed.
+     **/
+    class Node
+    {
+    public:
+        Node(XML::Document const & Document, std::uint32_t Index);
+        auto FindAttribute(std::string_view Name) const -> std::optional<std::string_view>;
+        auto GetAttribute(std::uint32_t Index) const -> XML::Attribute;
+        auto GetAttributeCount() const -> std::uint32_t;
+        auto GetFirstChild() const -> std::optional<XML::Node>;
+        auto GetKind() const -> XML::NodeKind;
+        auto GetLocation() const -> XML::Location const &;
+        auto GetName() const -> std::string_view;
+        auto GetNextSibling() const -> std::optional<XML::Node>;
+        auto GetParent() const -> std::optional<XML::Node>;
+        auto GetText() const -> std::string_view;
+    private:
+        XML::Document const * m_Document;
+        std::uint32_t m_Index;
+    };
+    
+    /**
+     * A document stores all its nodes in one array and all its names, texts and attribute values
+     * in one string. Nodes refer to each other by index. Clearing a document keeps the allocated
+     * memory for the next document, destroying it frees everything at once.
+     **/
+    class Document
+    {
+        friend class XML::DocumentBuilder;
+        friend class XML::Node;
+    public:
+        Document();
+        auto Clear() -> void;
+        auto GetNodeCount() const -> std::size_t;
+        auto GetRoot() const -> XML::Node;
+    private:
+        static constexpr auto NoNode = std::uint32_t{0xffffffff};
+        
+        class AttributeRecord
+        {
+        public:
+            std::uint32_t NameLength;
+            std::uint32_t NameOffset;
+            std::uint32_t ValueLength;
+            std::uint32_t ValueOffset;
+        };
+        
+        class NodeRecord
+        {
+        public:
+            std::uint32_t AttributeBegin;
+            std::uint32_t AttributeCount;
+            std::uint32_t ContentLength;
+            std::uint32_t ContentOffset;
+            std::uint32_t FirstChild;
+            XML::NodeKind Kind;
+            XML::Location Location;
+            std::uint32_t NextSibling;
+            std::uint32_t Parent;
+        };
+        
+        auto AppendString(std::string_view String) -> std::uint32_t;
+        auto GetString(std::uint32_t Offset, std::uint32_t Length) const -> std::string_view;
+        
+        std::vector<AttributeRecord> m_Attributes;
+        std::vector<NodeRecord> m_Nodes;
+        std::string m_Strings;
+    };
+    
+    /**
+     * Builds a document from the parser's events. The document is cleared when the builder is
+     * constructed.
+     **/
+    class DocumentBuilder : public XML::Parser
+    {
+    public:
+        DocumentBuilder(XML::Document & Document);
+        DocumentBuilder(XML::Document & Document, std::istream & InputStream);
+        DocumentBuilder(XML::Document & Document, std::span<char const> Data);
+        DocumentBuilder(XML::Document & Document, std::filesystem::path const & Path);
+        DocumentBuilder(XML::Document & Document, std::unique_ptr<XML::InputSource> InputSource);
+    private:
+        auto AppendNode(XML::NodeKind Kind, std::string_view Content, XML::Location const & Location) -> std::uint32_t;
+        auto CommentView(std::string_view Comment, XML::Location const & StartLocation) -> void override;
+        auto ElementStartView(std::string_view TagName, XML::Attributes Attributes, XML::Location const & StartLocation) -> void override;
+        auto ElementEndView(std::string_view TagName) -> void override;
+        auto Initialize() -> void;
+        auto TextView(std::string_view Text, XML::Location const & StartLocation) -> void override;
+        
+        XML::Document & m_Document;
+        std::vector<std::uint32_t> m_LastChildren;
+        std::vector<std::uint32_t> m_OpenElements;
+    };
+}
+
+#endif
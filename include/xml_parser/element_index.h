@@ -0,0 +1,77 @@
+/**
+ * Copyright 2026 Hagen Möbius
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+**/
+
+#ifndef XML_PARSER__ELEMENT_INDEX_H
+#define XML_PARSER__ELEMENT_INDEX_H
+
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <filesystem>
+#include <limits>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+namespace XML
+{
+    /**
+     * Maps the paths of elements, like "/archive/record", and their ordinals among the elements
+     * with the same path to the offsets of their start tags. The depth of an element is the number
+     * of steps in its path. While an index is set on the parser, it records every element that is
+     * not deeper than the maximum depth, which keeps the index small for documents with many small
+     * records. The index can be saved next to the document and loaded later on.
+     **/
+    class ElementIndex
+    {
+    public:
+        ElementIndex(std::size_t MaximumDepth = std::numeric_limits<std::size_t>::max());
+        auto Clear() -> void;
+        /**
+         * Called by the parser for every element, which needs location tracking with offsets.
+         **/
+        auto ElementEnd() -> void;
+        auto ElementStart(std::string_view Name, std::uint64_t Offset) -> void;
+        auto Find(std::string_view Path, std::uint64_t Ordinal) const -> std::optional<std::uint64_t>;
+        auto GetCount(std::string_view Path) const -> std::uint64_t;
+        auto GetPaths() const -> std::deque<std::string> const &;
+        /**
+         * Loading replaces the content of the index and leaves it empty if it fails. Both functions
+         * throw std::runtime_error if the file cannot be read or written, or if it is not an element
+         * index.
+         **/
+        auto Load(std::filesystem::path const & Path) -> void;
+        auto Save(std::filesystem::path const & Path) const -> void;
+    private:
+        std::size_t m_Depth;
+        std::size_t m_MaximumDepth;
+        std::vector<std::vector<std::uint64_t>> m_Offsets;
+        std::string m_Path;
+        std::unordered_map<std::string_view, std::size_t> m_PathIndices;
+        std::vector<std::size_t> m_PathLengths;
+        std::deque<std::string> m_Paths;
+    };
+}
+
+#endif
@@ -0,0 +1,180 @@
+/**
+ * Copyright 2026 Hagen Möbius
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+**/
+
+#ifndef XML_PARSER__ENTITIES_H
+#define XML_PARSER__ENTITIES_H
+
+#include <array>
+#include <cstdint>
+#include <string>
+#include <string_view>
+
+namespace XML
+{
+    namespace Detail
+    {
+        /**
+         * Decodes a numeric character reference like "#65" or "#x41" into UTF-8 in the buffer and
+         * returns a view of it. Returns an empty view if the reference is malformed or does not
+         * denote a character that XML allows.
+         **/
+        inline auto DecodeCharacterReference(std::string_view Name, std::array<char, 4> & Buffer) -> std::string_view
+        {
+            auto Base = std::uint32_t{10};
+            auto CodePoint = std::uint32_t{0};
+            
+            if((Name.size() < 2) || (Name[0] != '#'))
+            {
+                return {};
+            }
+            Name.remove_prefix(1);
+            if(Name[0] == 'x')
+            {
+                Base = 16;
+                Name.remove_prefix(1);
+                if(Name.empty() == true)
+                {
+                    return {};
+                }
+            }
+            for(auto Character : Name)
+            {
+                auto Digit = std::uint32_t{0};
+                
+                if((Character >= '0') && (Character <= '9'))
+                {
+                    Digit = Character - '0';
+                }
+                else if((Base == 16) && (Character >= 'a') && (Character <= 'f'))
+                {
+                    Digit = Character - 'a' + 10;
+                }
+                else if((Base == 16) && (Character >= 'A') && (Character <= 'F'))
+                {
+                    Digit = Character - 'A' + 10;
+                }
+                else
+                {
+                    return {};
+                }
+                CodePoint = CodePoint * Base + Digit;
+                if(CodePoint > 0x10ffff)
+                {
+                    return {};
+                }
+            }
+            // only the characters in the Char production of XML 1.0 may be referenced
+            if(((CodePoint < 0x20) && (CodePoint != 0x09) && (CodePoint != 0x0a) && (CodePoint != 0x0d)) || ((CodePoint >= 0xd800) && (CodePoint <= 0xdfff)) || (CodePoint == 0xfffe) || (CodePoint == 0xffff))
+            {
+                return {};
+            }
+            if(CodePoint < 0x80)
+            {
+                Buffer[0] = static_cast<char>(CodePoint);
+                
+                return {Buffer.data(), 1};
+            }
+            else if(CodePoint < 0x800)
+            {
+                Buffer[0] = static_cast<char>(0xc0 | (CodePoint >> 6));
+                Buffer[1] = static_cast<char>(0x80 | (CodePoint & 0x3f));
+                
+                return {Buffer.data(), 2};
+            }
+            else if(CodePoint < 0x10000)
+            {
+                Buffer[0] = static_cast<char>(0xe0 | (CodePoint >> 12));
+                Buffer[1] = static_cast<char>(0x80 | ((CodePoint >> 6) & 0x3f));
+                Buffer[2] = static_cast<char>(0x80 | (CodePoint & 0x3f));
+                
+                return {Buffer.data(), 3};
+            }
+            else
+            {
+                Buffer[0] = static_cast<char>(0xf0 | (CodePoint >> 18));
+                Buffer[1] = static_cast<char>(0x80 | ((CodePoint >> 12) & 0x3f));
+                Buffer[2] = static_cast<char>(0x80 | ((CodePoint >> 6) & 0x3f));
+                Buffer[3] = static_cast<char>(0x80 | (CodePoint & 0x3f));
+                
+                return {Buffer.data(), 4};
+            }
+        }
+        
+        /**
+         * Returns the character that a predefined entity stands for, or an empty view if the name is
+         * not that of a predefined entity.
+         **/
+        inline auto FindPredefinedEntity(std::string_view Name) -> std::string_view
+        {
+            if(Name == "amp")
+            {
+                return "&";
+            }
+            else if(Name == "gt")
+            {
+                return ">";
+            }
+            else if(Name == "lt")
+            {
+                return "<";
+            }
+            else if(Name == "apos")
+            {
+                return "'";
+            }
+            else if(Name == "quot")
+            {
+                return "\"";
+            }
+            else
+            {
+                return {};
+            }
+        }
+        
+        /**
+         * Returns what the entity stands for, or an empty view if it is unknown or malformed.
+         * Character references are encoded into the buffer.
+         **/
+        inline auto DecodeEntity(std::string_view Name, std::array<char, 4> & Buffer) -> std::string_view
+        {
+            if((Name.empty() == false) && (Name[0] == '#'))
+            {
+                return XML::Detail::DecodeCharacterReference(Name, Buffer);
+            }
+            else
+            {
+                return XML::Detail::FindPredefinedEntity(Name);
+            }
+        }
+    }
+    
+    /**
+     * Decodes the entities in a text or an attribute value that the parser delivered without
+     * decoding them. A text without '&' is returned as it is, without copying it. Otherwise, the
+     * text is decoded into the buffer and a view of the buffer is returned. Character references
+     * are decoded to UTF-8. Unknown entities are kept as they are.
+     **/
+    auto DecodeEntities(std::string_view Text, std::string & Buffer) -> std::string_view;
+}
+
+#endif
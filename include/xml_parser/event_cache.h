@@ -0,0 +1,109 @@
+/**
+ * Copyright 2026 Hagen Möbius
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+**/
+
+#ifndef XML_PARSER__EVENT_CACHE_H
+#define XML_PARSER__EVENT_CACHE_H
+
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <span>
+#include <string_view>
+#include <vector>
+
+#include <xml_parser/attributes.h>
+#include <xml_parser/input_source.h>
+#include <xml_parser/location.h>
+#include <xml_parser/reader.h>
+
+namespace XML
+{
+    class Parser;
+    
+    namespace Detail
+    {
+        /**
+         * An event as it is stored in an event cache. Names are indices into the cache's names,
+         * also those of the attributes, and all views point into the cache.
+         **/
+        class CachedEvent
+        {
+        public:
+            std::vector<XML::Attribute> Attributes;
+            XML::EventKind Kind;
+            XML::Location Location;
+            std::size_t NameIndex;
+            std::string_view Text;
+        };
+        
+        /**
+         * A fast hash of the content, to tell whether a cache was recorded from it. It is not
+         * meant to withstand deliberate collisions.
+         **/
+        auto HashContent(std::span<char const> Content) -> std::uint64_t;
+    }
+    
+    /**
+     * An event cache holds the events that the parser delivers for a document, with their names
+     * interned, their strings prefixed with their lengths and their locations, so that they can
+     * be replayed with XML::Parser::Replay() without parsing the document again. The cache file is
+     * mapped, and the replayed views point into it. A cache records the size and a hash of the
+     * document, so that a changed document can be detected before it is replayed.
+     **/
+    class EventCache
+    {
+    public:
+        /**
+         * Throws std::runtime_error if the file cannot be read, or if it is not an event cache of
+         * this version.
+         **/
+        EventCache(std::filesystem::path const & Path);
+        auto Matches(std::span<char const> Document) const -> bool;
+        /**
+         * Parses the document and writes its events to the file. Throws std::runtime_error if the
+         * file cannot be written.
+         **/
+        static auto Record(std::span<char const> Document, std::filesystem::path const & Path) -> void;
+    private:
+        friend class XML::Parser;
+        
+        auto GetName(std::size_t Index) const -> std::string_view;
+        auto GetNameCount() const -> std::size_t;
+        /**
+         * Decodes the event at the position and moves the position behind it. Returns false at
+         * the end of the events and throws std::runtime_error if the cache is corrupt.
+         **/
+        auto Next(std::size_t & Position, XML::Detail::CachedEvent & Event) const -> bool;
+        /**
+         * Moves the position from behind an element start event to the element's end event.
+         **/
+        auto SkipElement(std::size_t & Position, XML::Detail::CachedEvent & Event) const -> void;
+        
+        std::uint64_t m_DocumentHash;
+        std::uint64_t m_DocumentSize;
+        std::string_view m_Events;
+        XML::MappedFileInputSource m_File;
+        std::vector<std::string_view> m_Names;
+    };
+}
+
+#endif
@@ -0,0 +1,62 @@
+/**
+ * Copyright 2026 Hagen Möbius
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+**/
+
+#ifndef XML_PARSER__EVENT_STREAM_H
+#define XML_PARSER__EVENT_STREAM_H
+
+#include <memory>
+#include <string_view>
+
+#include <xml_parser/attributes.h>
+#include <xml_parser/generator.h>
+#include <xml_parser/input_source.h>
+#include <xml_parser/location.h>
+#include <xml_parser/reader.h>
+#include <xml_parser/symbol_table.h>
+
+namespace XML
+{
+    /**
+     * One event of the reader, with the same meaning of the members as the reader's getters. All
+     * views refer to the parser's buffers.
+     **/
+    class Event
+    {
+    public:
+        XML::Attributes Attributes;
+        XML::EventKind Kind;
+        XML::Location Location;
+        XML::Name Name;
+        std::string_view Text;
+    };
+    
+    /**
+     * Yields the events of the reader lazily, so that a range pipeline can filter them and stop
+     * early, without parsing further than it looks. An event is only valid until the iterator is
+     * incremented. The reader must outlive the generator, and SkipElement() may be called on it
+     * during an element start event.
+     **/
+    auto ReadEvents(XML::Reader & Reader) -> XML::Generator<XML::Event>;
+    auto ReadEvents(std::unique_ptr<XML::InputSource> InputSource) -> XML::Generator<XML::Event>;
+}
+
+#endif
@@ -0,0 +1,182 @@
+/**
+ * Copyright 2026 Hagen Möbius
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+**/
+
+#ifndef XML_PARSER__GENERATOR_H
+#define XML_PARSER__GENERATOR_H
+
+#include <coroutine>
+#include <cstddef>
+#include <exception>
+#include <iterator>
+#include <ranges>
+#include <utility>
+
+namespace XML
+{
+    /**
+     * A coroutine that yields references to values lazily, as a view that can be iterated once.
+     * The referenced values live in the coroutine and are only valid until the iterator is
+     * incremented. This is a small stand-in for C++23's std::generator, which C++20 lacks.
+     **/
+    template<typename ValueType>
+    class Generator : public std::ranges::view_interface<XML::Generator<ValueType>>
+    {
+    public:
+        class promise_type
+        {
+        public:
+            auto final_suspend() noexcept -> std::suspend_always
+            {
+                return {};
+            }
+            
+            auto get_return_object() -> XML::Generator<ValueType>
+            {
+                return XML::Generator<ValueType>{std::coroutine_handle<promise_type>::from_promise(*this)};
+            }
+            
+            auto initial_suspend() -> std::suspend_always
+            {
+                return {};
+            }
+            
+            auto return_void() -> void
+            {
+            }
+            
+            auto unhandled_exception() -> void
+            {
+                Exception = std::current_exception();
+            }
+            
+            auto yield_value(ValueType const & YieldedValue) -> std::suspend_always
+            {
+                Value = &YieldedValue;
+                
+                return {};
+            }
+            
+            std::exception_ptr Exception;
+            ValueType const * Value = nullptr;
+        };
+        
+        class Iterator
+        {
+        public:
+            using difference_type = std::ptrdiff_t;
+            using value_type = ValueType;
+            
+            auto operator*() const -> ValueType const &
+            {
+                return *m_Coroutine.promise().Value;
+            }
+            
+            auto operator++() -> Iterator &
+            {
+                XML::Generator<ValueType>::Resume(m_Coroutine);
+                
+                return *this;
+            }
+            
+            auto operator++(int) -> void
+            {
+                ++*this;
+            }
+            
+            auto operator==(std::default_sentinel_t) const -> bool
+            {
+                return m_Coroutine.done();
+            }
+        private:
+            friend class XML::Generator<ValueType>;
+            
+            std::coroutine_handle<promise_type> m_Coroutine;
+        };
+        
+        Generator(XML::Generator<ValueType> && Other) :
+            m_Coroutine{std::exchange(Other.m_Coroutine, nullptr)}
+        {
+        }
+        
+        ~Generator()
+        {
+            if(m_Coroutine != nullptr)
+            {
+                m_Coroutine.destroy();
+            }
+        }
+        
+        auto operator=(XML::Generator<ValueType> && Other) -> XML::Generator<ValueType> &
+        {
+            if(this != &Other)
+            {
+                if(m_Coroutine != nullptr)
+                {
+                    m_Coroutine.destroy();
+                }
+                m_Coroutine = std::exchange(Other.m_Coroutine, nullptr);
+            }
+            
+            return *this;
+        }
+        
+        /**
+         * Runs the coroutine up to its first value, so begin() may only be called once.
+         **/
+        auto begin() -> Iterator
+        {
+            Resume(m_Coroutine);
+            
+            auto Result = Iterator{};
+            
+            Result.m_Coroutine = m_Coroutine;
+            
+            return Result;
+        }
+        
+        auto end() const -> std::default_sentinel_t
+        {
+            return std::default_sentinel;
+        }
+    private:
+        explicit Generator(std::coroutine_handle<promise_type> Coroutine) :
+            m_Coroutine{Coroutine}
+        {
+        }
+        
+        /**
+         * An exception that escapes the coroutine is thrown again from the iterator.
+         **/
+        static auto Resume(std::coroutine_handle<promise_type> Coroutine) -> void
+        {
+            Coroutine.resume();
+            if(Coroutine.promise().Exception != nullptr)
+            {
+                std::rethrow_exception(std::exchange(Coroutine.promise().Exception, nullptr));
+            }
+        }
+        
+        std::coroutine_handle<promise_type> m_Coroutine;
+    };
+}
+
+#endif
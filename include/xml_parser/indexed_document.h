@@ -0,0 +1,169 @@
+/**
+ * Copyright 2026 Hagen Möbius
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+**/
+
+#ifndef XML_PARSER__INDEXED_DOCUMENT_H
+#define XML_PARSER__INDEXED_DOCUMENT_H
+
+#include <cstdint>
+#include <filesystem>
+#include <optional>
+#include <string_view>
+
+#include <xml_parser/basic_parser.h>
+#include <xml_parser/element_index.h>
+#include <xml_parser/input_source.h>
+
+namespace XML
+{
+    namespace Detail
+    {
+        /**
+         * Forwards the events of one element and its content, moving their offsets to where the
+         * element begins in the document, and suspends the parser at the end of the element.
+         **/
+        template<typename HandlerType>
+        class SubtreeHandler
+        {
+        public:
+            SubtreeHandler(HandlerType & Handler, std::uint64_t BaseOffset);
+            auto Comment(std::string_view Comment, XML::Location const & StartLocation) -> void requires requires(HandlerType & Handler, XML::Location const & Location) { Handler.Comment(Comment, Location); };
+            auto ElementEnd(XML::Name TagName) -> void;
+            auto ElementStart(XML::Name TagName, XML::Attributes Attributes, XML::Location const & StartLocation) -> void;
+            auto SetParser(XML::BasicParser<XML::Detail::SubtreeHandler<HandlerType>> & Parser) -> void;
+            auto Text(std::string_view Text, XML::Location const & StartLocation) -> void requires requires(HandlerType & Handler, XML::Location const & Location) { Handler.Text(Text, Location); };
+        private:
+            auto Rebase(XML::Location const & Location) const -> XML::Location;
+            
+            std::uint64_t m_BaseOffset;
+            std::uint64_t m_Depth;
+            HandlerType * m_Handler;
+            XML::BasicParser<XML::Detail::SubtreeHandler<HandlerType>> * m_Parser;
+        };
+    }
+    
+    /**
+     * Opens a document together with the element index that was built for it, so that single
+     * elements can be parsed without reading the document up to them. The index must have been
+     * built with offsets, by parsing the whole document with an element index set.
+     **/
+    class IndexedDocument
+    {
+    public:
+        IndexedDocument(std::filesystem::path const & DocumentPath, std::filesystem::path const & IndexPath);
+        auto GetIndex() const -> XML::ElementIndex const &;
+        /**
+         * Delivers the events of the element with the path and the ordinal, and of its content, to
+         * the handler, like XML::BasicParser does. The locations carry the offsets in the whole
+         * document, but no lines and columns. Returns false if the index has no such element, and
+         * throws std::runtime_error if the element is not where the index expects it, because the
+         * document has changed since the index was built.
+         **/
+        template<typename HandlerType>
+        auto ParseElement(HandlerType & Handler, std::string_view Path, std::uint64_t Ordinal) -> bool;
+    private:
+        auto Locate(std::string_view Path, std::uint64_t Ordinal) const -> std::optional<std::uint64_t>;
+        
+        XML::MappedFileInputSource m_Document;
+        XML::ElementIndex m_Index;
+    };
+}
+
+template<typename HandlerType>
+XML::Detail::SubtreeHandler<HandlerType>::SubtreeHandler(HandlerType & Handler, std::uint64_t BaseOffset) :
+    m_BaseOffset{BaseOffset},
+    m_Depth{0},
+    m_Handler{&Handler},
+    m_Parser{nullptr}
+{
+}
+
+template<typename HandlerType>
+auto XML::Detail::SubtreeHandler<HandlerType>::Comment(std::string_view Comment, XML::Location const & StartLocation) -> void requires requires(HandlerType & Handler, XML::Location const & Location) { Handler.Comment(Comment, Location); }
+{
+    m_Handler->Comment(Comment, Rebase(StartLocation));
+}
+
+template<typename HandlerType>
+auto XML::Detail::SubtreeHandler<HandlerType>::ElementEnd(XML::Name TagName) -> void
+{
+    if constexpr(requires { m_Handler->ElementEnd(TagName); })
+    {
+        m_Handler->ElementEnd(TagName);
+    }
+    m_Depth -= 1;
+    if(m_Depth == 0)
+    {
+        m_Parser->Suspend();
+    }
+}
+
+template<typename HandlerType>
+auto XML::Detail::SubtreeHandler<HandlerType>::ElementStart(XML::Name TagName, XML::Attributes Attributes, XML::Location const & StartLocation) -> void
+{
+    m_Depth += 1;
+    if constexpr(requires { m_Handler->ElementStart(TagName, Attributes, StartLocation); })
+    {
+        m_Handler->ElementStart(TagName, Attributes, Rebase(StartLocation));
+    }
+}
+
+template<typename HandlerType>
+auto XML::Detail::SubtreeHandler<HandlerType>::SetParser(XML::BasicParser<XML::Detail::SubtreeHandler<HandlerType>> & Parser) -> void
+{
+    m_Parser = &Parser;
+}
+
+template<typename HandlerType>
+auto XML::Detail::SubtreeHandler<HandlerType>::Text(std::string_view Text, XML::Location const & StartLocation) -> void requires requires(HandlerType & Handler, XML::Location const & Location) { Handler.Text(Text, Location); }
+{
+    m_Handler->Text(Text, Rebase(StartLocation));
+}
+
+template<typename HandlerType>
+auto XML::Detail::SubtreeHandler<HandlerType>::Rebase(XML::Location const & Location) const -> XML::Location
+{
+    return XML::Location{0, 0, m_BaseOffset + Location.Offset};
+}
+
+template<typename HandlerType>
+auto XML::IndexedDocument::ParseElement(HandlerType & Handler, std::string_view Path, std::uint64_t Ordinal) -> bool
+{
+    auto const Offset = Locate(Path, Ordinal);
+    
+    if(Offset.has_value() == true)
+    {
+        auto Subtree = XML::Detail::SubtreeHandler<HandlerType>{Handler, Offset.value()};
+        auto Parser = XML::BasicParser<XML::Detail::SubtreeHandler<HandlerType>>{Subtree, m_Document.GetData().subspan(Offset.value())};
+        
+        Subtree.SetParser(Parser);
+        Parser.SetLocationTracking(XML::LocationTracking::Offsets);
+        Parser.Parse();
+        
+        return true;
+    }
+    else
+    {
+        return false;
+    }
+}
+
+#endif
@@ -0,0 +1,82 @@
+/**
+ * Copyright 2026 Hagen Möbius
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+**/
+
+#ifndef XML_PARSER__INPUT_SOURCE_H
+#define XML_PARSER__INPUT_SOURCE_H
+
+#include <cstddef>
+#include <filesystem>
+#include <istream>
+#include <span>
+#include <vector>
+
+namespace XML
+{
+    /**
+     * An input source hands the parser its input in contiguous blocks. A block stays valid until
+     * the next call to Read(). An empty block marks the end of the input.
+     **/
+    class InputSource
+    {
+    public:
+        virtual ~InputSource() = default;
+        virtual auto Read() -> std::span<char const> = 0;
+    };
+    
+    class MappedFileInputSource : public XML::InputSource
+    {
+    public:
+        MappedFileInputSource(std::filesystem::path const & Path);
+        MappedFileInputSource(XML::MappedFileInputSource const &) = delete;
+        ~MappedFileInputSource() override;
+        auto operator=(XML::MappedFileInputSource const &) -> XML::MappedFileInputSource & = delete;
+        auto GetData() const -> std::span<char const>;
+        auto Read() -> std::span<char const> override;
+    private:
+        char const * m_Data;
+        std::size_t m_Size;
+        bool m_Read;
+    };
+    
+    class MemoryInputSource : public XML::InputSource
+    {
+    public:
+        MemoryInputSource(std::span<char const> Data);
+        auto GetData() const -> std::span<char const>;
+        auto Read() -> std::span<char const> override;
+    private:
+        std::span<char const> m_Data;
+        bool m_Read;
+    };
+    
+    class StreamInputSource : public XML::InputSource
+    {
+    public:
+        StreamInputSource(std::istream & InputStream, std::size_t BlockSize = 256 * 1024);
+        auto Read() -> std::span<char const> override;
+    private:
+        std::vector<char> m_Block;
+        std::istream & m_InputStream;
+    };
+}
+
+#endif
@@ -0,0 +1,61 @@
+/**
+ * Copyright 2026 Hagen Möbius
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+**/
+
+#ifndef XML_PARSER__LINE_INDEX_H
+#define XML_PARSER__LINE_INDEX_H
+
+#include <cstdint>
+#include <span>
+#include <vector>
+
+#include <xml_parser/location.h>
+
+namespace XML
+{
+    /**
+     * Records the offsets of the line breaks in a document, so that offsets can be resolved into
+     * lines and columns when they are needed. The document can be appended piece by piece, for
+     * example by the parser as it reads its input.
+     **/
+    class LineIndex
+    {
+    public:
+        LineIndex();
+        LineIndex(std::span<char const> Data);
+        /**
+         * Appends the next piece of the document.
+         **/
+        auto Append(std::span<char const> Data) -> void;
+        auto Clear() -> void;
+        auto GetSize() const -> std::uint64_t;
+        /**
+         * Returns the location at the offset, which may lie beyond the appended part of the
+         * document, in which case it is assumed to be on the last line.
+         **/
+        auto Resolve(std::uint64_t Offset) const -> XML::Location;
+    private:
+        std::vector<std::uint64_t> m_LineBreaks;
+        std::uint64_t m_Size;
+    };
+}
+
+#endif
@@ -0,0 +1,56 @@
+/**
+ * Copyright 2026 Hagen Möbius
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+**/
+
+#ifndef XML_PARSER__LOCATION_H
+#define XML_PARSER__LOCATION_H
+
+#include <cstdint>
+
+namespace XML
+{
+    /**
+     * The line and the column count from zero, the column in bytes. The offset is the number of
+     * bytes before the location in the document.
+     **/
+    class Location
+    {
+    public:
+        std::uint64_t Column;
+        std::uint64_t Line;
+        std::uint64_t Offset;
+    };
+    
+    /**
+     * How much of the locations the parser determines. Tracking lines and columns costs a little
+     * for every byte, offsets only cost a little for every event. With offsets only, lines and
+     * columns are zero and can be determined on demand with an XML::LineIndex. Without tracking,
+     * all locations are zero.
+     **/
+    enum class LocationTracking : std::uint8_t
+    {
+        LinesAndColumns,
+        None,
+        Offsets
+    };
+}
+
+#endif
@@ -0,0 +1,70 @@
+/**
+ * Copyright 2026 Hagen Möbius
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+**/
+
+#ifndef XML_PARSER__NUMBERS_H
+#define XML_PARSER__NUMBERS_H
+
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <string_view>
+
+namespace XML
+{
+    namespace Detail
+    {
+        /**
+         * The files that the library writes store numbers in seven bit groups, least significant
+         * first, with the high bit marking that another group follows.
+         **/
+        inline auto AppendNumber(std::string & Buffer, std::uint64_t Number) -> void
+        {
+            while(Number >= 0x80)
+            {
+                Buffer += static_cast<char>((Number & 0x7f) | 0x80);
+                Number >>= 7;
+            }
+            Buffer += static_cast<char>(Number);
+        }
+        
+        inline auto ReadNumber(std::string_view & Buffer) -> std::optional<std::uint64_t>
+        {
+            auto Result = std::uint64_t{0};
+            
+            for(auto Shift = 0u; (Buffer.empty() == false) && (Shift < 64); Shift += 7)
+            {
+                auto const Byte = static_cast<unsigned char>(Buffer.front());
+                
+                Buffer.remove_prefix(1);
+                Result |= static_cast<std::uint64_t>(Byte & 0x7f) << Shift;
+                if((Byte & 0x80) == 0)
+                {
+                    return Result;
+                }
+            }
+            
+            return std::nullopt;
+        }
+    }
+}
+
+#endif
@@ -0,0 +1,426 @@
+/**
+ * Copyright 2026 Hagen Möbius
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+**/
+
+#ifndef XML_PARSER__PARALLEL_PARSER_H
+#define XML_PARSER__PARALLEL_PARSER_H
+
+#include <algorithm>
+#include <condition_variable>
+#include <cstddef>
+#include <exception>
+#include <filesystem>
+#include <memory>
+#include <mutex>
+#include <span>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include <xml_parser/basic_parser.h>
+#include <xml_parser/input_source.h>
+#include <xml_parser/reader.h>
+#include <xml_parser/symbol_table.h>
+
+namespace XML
+{
+    namespace Detail
+    {
+        /**
+         * Refers to a string either in the input or, if the parser had to copy or decode it, in the
+         * recorder's pool.
+         **/
+        class StringReference
+        {
+        public:
+            std::size_t Offset;
+            std::size_t Length;
+            bool Pooled;
+        };
+        
+        class RecordedEvent
+        {
+        public:
+            XML::EventKind Kind;
+            XML::Detail::StringReference Content;
+            XML::Location Location;
+            std::size_t AttributeBegin;
+            std::size_t AttributeCount;
+        };
+        
+        /**
+         * Records the events of a chunk of the input, so that they can be delivered in document order
+         * after the chunks before it.
+         **/
+        class EventRecorder
+        {
+        public:
+            EventRecorder(std::span<char const> Data);
+            auto Clear() -> void;
+            auto Comment(std::string_view Comment, XML::Location const & StartLocation) -> void;
+            auto ElementStart(std::string_view TagName, XML::Attributes Attributes, XML::Location const & StartLocation) -> void;
+            auto ElementEnd(std::string_view TagName) -> void;
+            auto GetAttribute(std::size_t Index) const -> std::pair<XML::Detail::StringReference, XML::Detail::StringReference> const &;
+            auto GetEvents() const -> std::vector<XML::Detail::RecordedEvent> const &;
+            auto GetString(XML::Detail::StringReference const & Reference) const -> std::string_view;
+            auto Text(std::string_view Text, XML::Location const & StartLocation) -> void;
+        private:
+            auto MakeReference(std::string_view String) -> XML::Detail::StringReference;
+            
+            std::vector<std::pair<XML::Detail::StringReference, XML::Detail::StringReference>> m_Attributes;
+            std::span<char const> m_Data;
+            std::vector<XML::Detail::RecordedEvent> m_Events;
+            std::string m_Pool;
+        };
+        
+        /**
+         * Returns the offsets at which the chunks begin, followed by the size of the data. Every chunk
+         * but the first begins with a '<', which is the most likely start of a tag, at least
+         * ChunkSize characters after the begin of the previous chunk.
+         **/
+        auto SplitIntoChunks(std::span<char const> Data, std::size_t ChunkSize) -> std::vector<std::size_t>;
+        
+        /**
+         * Returns the location that the relative location has in a part of the input that starts at
+         * the base location.
+         **/
+        auto Rebase(XML::Location const & Base, XML::Location const & Relative) -> XML::Location;
+    }
+    
+    /**
+     * The parallel parser splits an input that is completely in memory into chunks and parses them
+     * on several threads. Each chunk is parsed on the assumption that it begins in the document
+     * scope with the '<' of a tag. Before the events of a chunk are delivered, this assumption is
+     * checked against the state in which the previous chunk ended. If it does not hold, because the
+     * '<' belongs to a comment or an attribute value, the events of the chunk are discarded and the
+     * chunk is parsed again after the previous one. The handler receives the same events in the
+     * same order as from XML::BasicParser, always on the thread that calls Parse(). Handlers must
+     * not call Suspend().
+     **/
+    template<typename HandlerType>
+    class ParallelParser
+    {
+    public:
+        ParallelParser(HandlerType & Handler, std::span<char const> Data, unsigned int ThreadCount = std::thread::hardware_concurrency(), std::size_t ChunkSize = 4 * 1024 * 1024);
+        ParallelParser(HandlerType & Handler, std::filesystem::path const & Path, unsigned int ThreadCount = std::thread::hardware_concurrency(), std::size_t ChunkSize = 4 * 1024 * 1024);
+        auto Parse() -> void;
+        /**
+         * Names are interned on the thread that calls Parse(), so the symbol table is not shared
+         * between threads.
+         **/
+        auto SetSymbolTable(XML::SymbolTable * SymbolTable) -> void;
+    private:
+        class Segment
+        {
+        public:
+            Segment(std::span<char const> Data) :
+                Base{0, 0, 0},
+                Parser{Recorder},
+                Recorder{Data}
+            {
+            }
+            
+            XML::Location Base;
+            XML::BasicParser<XML::Detail::EventRecorder> Parser;
+            XML::Detail::EventRecorder Recorder;
+        };
+        
+        auto Deliver(Segment & Segment) -> void;
+        auto GetChunk(std::size_t Index) const -> std::span<char const>;
+        auto MakeName(std::string_view Text) -> XML::Name;
+        auto Work() -> void;
+        
+        std::vector<XML::Attribute> m_AttributeViews;
+        std::vector<std::size_t> m_ChunkBegins;
+        std::size_t m_ChunkSize;
+        std::condition_variable m_Condition;
+        std::span<char const> m_Data;
+        std::size_t m_DeliveredChunkCount;
+        std::exception_ptr m_Exception;
+        HandlerType & m_Handler;
+        std::unique_ptr<XML::MappedFileInputSource> m_MappedFile;
+        std::mutex m_Mutex;
+        std::size_t m_NextChunk;
+        std::vector<std::unique_ptr<Segment>> m_Segments;
+        bool m_Stopped;
+        XML::SymbolTable * m_SymbolTable;
+        unsigned int m_ThreadCount;
+    };
+}
+
+template<typename HandlerType>
+XML::ParallelParser<HandlerType>::ParallelParser(HandlerType & Handler, std::span<char const> Data, unsigned int ThreadCount, std::size_t ChunkSize) :
+    m_ChunkSize{std::max(ChunkSize, std::size_t{1})},
+    m_Data{Data},
+    m_DeliveredChunkCount{0},
+    m_Handler(Handler),
+    m_NextChunk{0},
+    m_Stopped{false},
+    m_SymbolTable{nullptr},
+    m_ThreadCount{std::max(ThreadCount, 1u)}
+{
+}
+
+template<typename HandlerType>
+XML::ParallelParser<HandlerType>::ParallelParser(HandlerType & Handler, std::filesystem::path const & Path, unsigned int ThreadCount, std::size_t ChunkSize) :
+    m_ChunkSize{std::max(ChunkSize, std::size_t{1})},
+    m_DeliveredChunkCount{0},
+    m_Handler(Handler),
+    m_MappedFile{std::make_unique<XML::MappedFileInputSource>(Path)},
+    m_NextChunk{0},
+    m_Stopped{false},
+    m_SymbolTable{nullptr},
+    m_ThreadCount{std::max(ThreadCount, 1u)}
+{
+    m_Data = m_MappedFile->GetData();
+}
+
+template<typename HandlerType>
+auto XML::ParallelParser<HandlerType>::Parse() -> void
+{
+    m_ChunkBegins = XML::Detail::SplitIntoChunks(m_Data, m_ChunkSize);
+    
+    auto const ChunkCount = m_ChunkBegins.size() - 1;
+    
+    if((m_ThreadCount == 1) || (ChunkCount == 1))
+    {
+        // recording and replaying the events only pays off if chunks are parsed at the same time
+        auto Parser = XML::BasicParser<HandlerType>{m_Handler, m_Data};
+        
+        Parser.SetSymbolTable(m_SymbolTable);
+        Parser.Parse();
+        
+        return;
+    }
+    m_DeliveredChunkCount = 0;
+    m_Exception = nullptr;
+    m_NextChunk = 0;
+    m_Segments.clear();
+    m_Segments.resize(ChunkCount);
+    m_Stopped = false;
+    
+    auto Threads = std::vector<std::jthread>{};
+    
+    for(auto ThreadIndex = 0u; ThreadIndex < m_ThreadCount; ++ThreadIndex)
+    {
+        Threads.emplace_back([this]() { Work(); });
+    }
+    try
+    {
+        auto Current = std::unique_ptr<Segment>{};
+        
+        for(auto Index = std::size_t{0}; Index < ChunkCount; ++Index)
+        {
+            auto Next = std::unique_ptr<Segment>{};
+            
+            {
+                auto Lock = std::unique_lock{m_Mutex};
+                
+                m_Condition.wait(Lock, [this, Index]() { return (m_Segments[Index] != nullptr) || (m_Exception != nullptr); });
+                if(m_Exception != nullptr)
+                {
+                    std::rethrow_exception(m_Exception);
+                }
+                Next = std::move(m_Segments[Index]);
+            }
+            if(Current == nullptr)
+            {
+                Current = std::move(Next);
+            }
+            else if((Current->Parser.m_ParsingStage == 1) && (Current->Parser.m_StartLocation.has_value() == true) && (Current->Parser.m_StartLocation->Offset + 1 == Current->Parser.m_CurrentLocation.Offset))
+            {
+                // the current parser has consumed the '<' at the begin of this chunk in the document scope, just like the chunk's own parser did, and not after an earlier '<' that opened the tag
+                auto EndLocation = Current->Parser.m_CurrentLocation;
+                
+                EndLocation.Column -= 1;
+                EndLocation.Offset -= 1;
+                Next->Base = XML::Detail::Rebase(Current->Base, EndLocation);
+                Current = std::move(Next);
+            }
+            else
+            {
+                // the chunk's own parser started in the wrong state, so the current parser continues after the '<' it has already consumed
+                Current->Parser.Feed(GetChunk(Index).subspan(1));
+            }
+            Deliver(*Current);
+            Current->Recorder.Clear();
+            
+            auto Lock = std::unique_lock{m_Mutex};
+            
+            m_DeliveredChunkCount = Index + 1;
+            m_Condition.notify_all();
+        }
+    }
+    catch(...)
+    {
+        {
+            auto Lock = std::unique_lock{m_Mutex};
+            
+            m_Stopped = true;
+            m_Condition.notify_all();
+        }
+        
+        throw;
+    }
+}
+
+template<typename HandlerType>
+auto XML::ParallelParser<HandlerType>::SetSymbolTable(XML::SymbolTable * SymbolTable) -> void
+{
+    m_SymbolTable = SymbolTable;
+}
+
+template<typename HandlerType>
+auto XML::ParallelParser<HandlerType>::Deliver(Segment & Segment) -> void
+{
+    for(auto const & Event : Segment.Recorder.GetEvents())
+    {
+        [[maybe_unused]] auto const Content = Segment.Recorder.GetString(Event.Content);
+        [[maybe_unused]] auto const Location = XML::Detail::Rebase(Segment.Base, Event.Location);
+        
+        switch(Event.Kind)
+        {
+        case XML::EventKind::Comment:
+            {
+                if constexpr(requires { m_Handler.Comment(Content, Location); })
+                {
+                    m_Handler.Comment(Content, Location);
+                }
+                
+                break;
+            }
+        case XML::EventKind::ElementEnd:
+            {
+                if constexpr(requires { m_Handler.ElementEnd(MakeName(Content)); })
+                {
+                    m_Handler.ElementEnd(MakeName(Content));
+                }
+                
+                break;
+            }
+        case XML::EventKind::ElementStart:
+            {
+                if constexpr(requires { m_Handler.ElementStart(MakeName(Content), XML::Attributes{}, Location); })
+                {
+                    m_AttributeViews.clear();
+                    for(auto Index = Event.AttributeBegin; Index < Event.AttributeBegin + Event.AttributeCount; ++Index)
+                    {
+                        auto const & Attribute = Segment.Recorder.GetAttribute(Index);
+                        auto const Name = MakeName(Segment.Recorder.GetString(Attribute.first));
+                        
+                        m_AttributeViews.push_back(XML::Attribute{Name.Text, Segment.Recorder.GetString(Attribute.second), Name.Id});
+                    }
+                    m_Handler.ElementStart(MakeName(Content), XML::Attributes{m_AttributeViews}, Location);
+                }
+                
+                break;
+            }
+        case XML::EventKind::End:
+            {
+                break;
+            }
+        case XML::EventKind::Text:
+            {
+                if constexpr(requires { m_Handler.Text(Content, Location); })
+                {
+                    m_Handler.Text(Content, Location);
+                }
+                
+                break;
+            }
+        }
+    }
+}
+
+/**
+ * Returns the characters of the chunk and, if there is a next chunk, the '<' it begins with.
+ **/
+template<typename HandlerType>
+auto XML::ParallelParser<HandlerType>::GetChunk(std::size_t Index) const -> std::span<char const>
+{
+    auto const Begin = m_ChunkBegins[Index];
+    auto const End = std::min(m_ChunkBegins[Index + 1] + 1, m_Data.size());
+    
+    return m_Data.subspan(Begin, End - Begin);
+}
+
+template<typename HandlerType>
+auto XML::ParallelParser<HandlerType>::MakeName(std::string_view Text) -> XML::Name
+{
+    if(m_SymbolTable != nullptr)
+    {
+        return XML::Name{Text, m_SymbolTable->Intern(Text)};
+    }
+    else
+    {
+        return XML::Name{Text, XML::NoSymbol};
+    }
+}
+
+template<typename HandlerType>
+auto XML::ParallelParser<HandlerType>::Work() -> void
+{
+    // only a limited number of chunks is parsed ahead of the delivery, which bounds the memory for the recorded events
+    auto const ChunkCount = m_Segments.size();
+    auto const Window = std::size_t{2} * m_ThreadCount;
+    
+    while(true)
+    {
+        auto Index = std::size_t{0};
+        
+        {
+            auto Lock = std::unique_lock{m_Mutex};
+            
+            m_Condition.wait(Lock, [this, ChunkCount, Window]() { return (m_Stopped == true) || (m_NextChunk == ChunkCount) || (m_NextChunk < m_DeliveredChunkCount + Window); });
+            if((m_Stopped == true) || (m_NextChunk == ChunkCount))
+            {
+                return;
+            }
+            Index = m_NextChunk;
+            ++m_NextChunk;
+        }
+        try
+        {
+            auto Segment = std::make_unique<typename XML::ParallelParser<HandlerType>::Segment>(m_Data);
+            
+            Segment->Parser.Feed(GetChunk(Index));
+            
+            auto Lock = std::unique_lock{m_Mutex};
+            
+            m_Segments[Index] = std::move(Segment);
+            m_Condition.notify_all();
+        }
+        catch(...)
+        {
+            auto Lock = std::unique_lock{m_Mutex};
+            
+            m_Exception = std::current_exception();
+            m_Stopped = true;
+            m_Condition.notify_all();
+            
+            return;
+        }
+    }
+}
+
+#endif
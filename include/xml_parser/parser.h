@@ -1,5 +1,5 @@
 /**
- * Copyright 2021-2022 Hagen Möbius
+ * Copyright 2021-2026 Hagen Möbius
  * 
  * Permission is hereby granted, free of charge, to any person obtaining a copy
  * of this software and associated documentation files (the "Software"), to
@@ -23,32 +23,138 @@
 #ifndef XML_PARSER__PARSER_H
 #define XML_PARSER__PARSER_H
 
-#include <cstdint>
+#include <filesystem>
 #include <istream>
 #include <map>
+#include <memory>
+#include <span>
+#include <string>
+#include <string_view>
+
+#include <xml_parser/basic_parser.h>
+#include <xml_parser/event_cache.h>
+#include <xml_parser/input_source.h>
 
 namespace XML
 {
-    class Location
-    {
-    public:
-        std::uint64_t Column;
-        std::uint64_t Line;
-    };
-    
+    /**
+     * The parser delivers its events through virtual functions, which makes it easy to derive from
+     * but costs an indirect call per event. Use XML::BasicParser with a handler class where that
+     * matters.
+     **/
     class Parser
     {
     public:
+        Parser();
         Parser(std::istream & InputStream);
+        Parser(std::span<char const> Data);
+        Parser(std::filesystem::path const & Path);
+        Parser(std::unique_ptr<XML::InputSource> InputSource);
         virtual ~Parser() = default;
+        /**
+         * Parses a chunk of input, which may end anywhere, even inside a name or an entity. The
+         * chunk is not referenced after the call. Finish() ends the input and resets the parser,
+         * so that it can be fed the next document.
+         **/
+        auto Feed(std::span<char const> Chunk) -> void;
+        auto Finish() -> void;
+        /**
+         * Parses the input until it ends or until a callback calls Suspend(). The next call to
+         * Parse() continues where the last one stopped.
+         **/
         auto Parse() -> void;
+        /**
+         * Delivers the events recorded in the event cache to the callbacks, as if the document
+         * was parsed, but without tokenizing it. SkipElement() works as usual, and Suspend() ends
+         * the replay. With a symbol table, the names are interned once per replay, so that
+         * GetTagNameId() and the attributes carry the table's ids.
+         **/
+        auto Replay(XML::EventCache const & Cache) -> void;
+        /**
+         * Without decoding, the view functions receive texts and attribute values with their
+         * entities as they appear in the input. XML::DecodeEntities() decodes them on demand.
+         **/
+        auto SetDecodeEntities(bool DecodeEntities) -> void;
+        auto SetElementIndex(XML::ElementIndex * ElementIndex) -> void;
+        /**
+         * With a fragment size other than zero, texts and comments are delivered to
+         * CommentFragmentView() and TextFragmentView() in fragments of at most that many characters.
+         **/
+        auto SetFragmentSize(std::size_t FragmentSize) -> void;
+        /**
+         * The parser appends its input to the line index, which resolves the offsets of the
+         * locations into lines and columns on demand.
+         **/
+        auto SetLineIndex(XML::LineIndex * LineIndex) -> void;
+        auto SetLocationTracking(XML::LocationTracking LocationTracking) -> void;
+        /**
+         * While statistics are set, the parser updates them as it goes. They must outlive the parser,
+         * or be unset by passing nullptr.
+         **/
+        auto SetStatistics(XML::Statistics * Statistics) -> void;
+        /**
+         * Element and attribute names are interned into the symbol table, which must outlive the
+         * parser. The ids are available as XML::Attribute::NameId and from GetTagNameId().
+         **/
+        auto SetSymbolTable(XML::SymbolTable * SymbolTable) -> void;
     protected:
         virtual auto Comment(std::string const & Comment, XML::Location const & StartLocation) -> void;
         virtual auto ElementStart(std::string const & TagName, std::map<std::string, std::string> const & Attributes, XML::Location const & StartLocation) -> void;
         virtual auto ElementEnd(std::string const & TagName) -> void;
         virtual auto Text(std::string const & Text, XML::Location const & StartLocation) -> void;
+        /**
+         * The view callbacks receive names, texts and attribute values as views into the parser's
+         * input block, which are only valid for the duration of the call. By default, they copy
+         * their arguments and forward them to the callbacks above.
+         **/
+        virtual auto CommentView(std::string_view Comment, XML::Location const & StartLocation) -> void;
+        virtual auto ElementStartView(std::string_view TagName, XML::Attributes Attributes, XML::Location const & StartLocation) -> void;
+        virtual auto ElementEndView(std::string_view TagName) -> void;
+        virtual auto TextView(std::string_view Text, XML::Location const & StartLocation) -> void;
+        /**
+         * The fragment callbacks do nothing by default.
+         **/
+        virtual auto CommentFragmentView(std::string_view Fragment, XML::Location const & StartLocation, bool First, bool Last) -> void;
+        virtual auto TextFragmentView(std::string_view Fragment, XML::Location const & StartLocation, bool First, bool Last) -> void;
+        /**
+         * Returns the id of the tag name during ElementStartView() and ElementEndView(), or
+         * XML::NoSymbol if the parser has no symbol table.
+         **/
+        auto GetTagNameId() const -> XML::SymbolId;
+        /**
+         * Called from ElementStart() or ElementStartView(), the parser skips the content of the
+         * element without calling any callbacks until the element's end.
+         **/
+        auto SkipElement() -> void;
+        auto Suspend() -> void;
     private:
-        std::istream & m_InputStream;
+        /**
+         * Forwards the events of the basic parser to the virtual view callbacks.
+         **/
+        class Handler
+        {
+        public:
+            Handler(XML::Parser & Parser);
+            auto Comment(std::string_view Comment, XML::Location const & StartLocation) -> void;
+            auto CommentFragment(std::string_view Fragment, XML::Location const & StartLocation, bool First, bool Last) -> void;
+            auto ElementStart(XML::Name TagName, XML::Attributes Attributes, XML::Location const & StartLocation) -> void;
+            auto ElementEnd(XML::Name TagName) -> void;
+            auto Text(std::string_view Text, XML::Location const & StartLocation) -> void;
+            auto TextFragment(std::string_view Fragment, XML::Location const & StartLocation, bool First, bool Last) -> void;
+        private:
+            XML::Parser & m_Parser;
+        };
+        
+        Handler m_Handler;
+        XML::BasicParser<Handler> m_Parser;
+        XML::SymbolId m_TagNameId;
+        bool m_Replaying;
+        bool m_ReplaySkipping;
+        bool m_ReplaySuspended;
+        XML::SymbolTable * m_SymbolTable;
+        std::map<std::string, std::string> m_Attributes;
+        std::string m_Content;
+        std::string m_TagName;
     };
 }
 
@@ -0,0 +1,136 @@
+/**
+ * Copyright 2026 Hagen Möbius
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+**/
+
+#ifndef XML_PARSER__PATH_DISPATCHER_H
+#define XML_PARSER__PATH_DISPATCHER_H
+
+#include <cstddef>
+#include <filesystem>
+#include <functional>
+#include <istream>
+#include <memory>
+#include <optional>
+#include <span>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include <xml_parser/input_source.h>
+#include <xml_parser/parser.h>
+#include <xml_parser/symbol_table.h>
+
+namespace XML
+{
+    /**
+     * The callbacks of a subscription are called for the elements that match its path pattern.
+     * Text() receives the texts directly inside a matching element. Callbacks that are not set are
+     * not called. The callbacks of several subscriptions for the same element are called in no
+     * particular order.
+     **/
+    class PathSubscription
+    {
+    public:
+        std::function<void (std::string_view TagName, XML::Attributes Attributes, XML::Location const & StartLocation)> ElementStart;
+        std::function<void (std::string_view TagName)> ElementEnd;
+        std::function<void (std::string_view Text, XML::Location const & StartLocation)> Text;
+    };
+    
+    /**
+     * Dispatches the parser's events to subscriptions for path patterns. A pattern is a sequence of
+     * steps, each introduced by '/' for a child or by '//' for a descendant, like "/feed/entry/title"
+     * or "//item". A step is an element name or '*' for any element, optionally followed by a
+     * predicate "[@name]" or "[@name='value']" on an attribute.
+     * 
+     * All patterns are compiled into one automaton, in which patterns with common prefixes share
+     * their states. For every element, the dispatcher steps from the states of the parent element
+     * to those of the element. Elements in which no pattern can match any more are skipped by the
+     * parser without building their names, texts or attributes.
+     **/
+    class PathDispatcher : public XML::Parser
+    {
+    public:
+        PathDispatcher();
+        PathDispatcher(std::istream & InputStream);
+        PathDispatcher(std::span<char const> Data);
+        PathDispatcher(std::filesystem::path const & Path);
+        PathDispatcher(std::unique_ptr<XML::InputSource> InputSource);
+        /**
+         * Adds a subscription. Throws std::invalid_argument if the pattern is malformed. All
+         * subscriptions must be added before parsing starts.
+         **/
+        auto Subscribe(std::string_view Pattern, XML::PathSubscription Subscription) -> void;
+    private:
+        /**
+         * An edge leads from one state to the next for the elements that match its step. Edges for
+         * any element have XML::NoSymbol as their name id.
+         **/
+        class Edge
+        {
+        public:
+            std::optional<std::string> AttributeName;
+            std::optional<std::string> AttributeValue;
+            bool Descendant;
+            XML::SymbolId NameId;
+            std::size_t Target;
+        };
+        
+        /**
+         * An active state of an element. A state that is only carried along for its descendant
+         * edges was entered by an ancestor, and neither matches the element nor follows its child
+         * edges.
+         **/
+        class ActiveState
+        {
+        public:
+            bool Carried;
+            std::size_t State;
+        };
+        
+        /**
+         * The edges of a state are sorted by their name ids, so that the edges for an element are
+         * found by a binary search.
+         **/
+        class State
+        {
+        public:
+            std::vector<XML::PathDispatcher::Edge> Edges;
+            bool HasDescendantEdges = false;
+            std::vector<std::size_t> Subscriptions;
+        };
+        
+        auto CommentView(std::string_view Comment, XML::Location const & StartLocation) -> void override;
+        auto ElementStartView(std::string_view TagName, XML::Attributes Attributes, XML::Location const & StartLocation) -> void override;
+        auto ElementEndView(std::string_view TagName) -> void override;
+        auto Enter(std::size_t State, bool Carried) -> void;
+        auto Initialize() -> void;
+        static auto MatchesPredicate(XML::PathDispatcher::Edge const & Edge, XML::Attributes Attributes) -> bool;
+        auto TextView(std::string_view Text, XML::Location const & StartLocation) -> void override;
+        
+        std::vector<XML::PathDispatcher::ActiveState> m_ActiveStates;
+        std::vector<std::size_t> m_Levels;
+        std::vector<XML::PathDispatcher::State> m_States;
+        std::vector<XML::PathSubscription> m_Subscriptions;
+        XML::SymbolTable m_SymbolTable;
+    };
+}
+
+#endif
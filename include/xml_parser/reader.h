@@ -0,0 +1,98 @@
+/**
+ * Copyright 2026 Hagen Möbius
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+**/
+
+
+#ifndef XML_PARSER__READER_H
+#define XML_PARSER__READER_H
+
+#include <filesystem>
+#include <istream>
+#include <memory>
+#include <span>
+#include <string_view>
+
+#include <xml_parser/basic_parser.h>
+#include <xml_parser/input_source.h>
+
+namespace XML
+{
+    enum class EventKind
+    {
+        Comment,
+        ElementEnd,
+        ElementStart,
+        End,
+        Text
+    };
+    
+    /**
+     * The reader is a pull interface to the parser: every call to Next() parses up to the next
+     * event and returns its kind. The views returned by the getters stay valid until the next call
+     * to Next(). GetText() returns the text of a text or a comment event, GetName() and
+     * GetAttributes() describe element events. Element end events have no location. With a symbol
+     * table, GetNameId() returns the id of the element name.
+     **/
+    class Reader
+    {
+    public:
+        Reader(std::istream & InputStream);
+        Reader(std::span<char const> Data);
+        Reader(std::filesystem::path const & Path);
+        Reader(std::unique_ptr<XML::InputSource> InputSource);
+        auto GetAttributes() const -> XML::Attributes;
+        auto GetEventKind() const -> XML::EventKind;
+        auto GetLocation() const -> XML::Location const &;
+        auto GetName() const -> std::string_view;
+        auto GetNameId() const -> XML::SymbolId;
+        auto GetText() const -> std::string_view;
+        auto Next() -> XML::EventKind;
+        auto SetDecodeEntities(bool DecodeEntities) -> void;
+        auto SetElementIndex(XML::ElementIndex * ElementIndex) -> void;
+        auto SetLineIndex(XML::LineIndex * LineIndex) -> void;
+        auto SetLocationTracking(XML::LocationTracking LocationTracking) -> void;
+        auto SetStatistics(XML::Statistics * Statistics) -> void;
+        auto SetSymbolTable(XML::SymbolTable * SymbolTable) -> void;
+        /**
+         * After an element start event, the next call to Next() skips the content of the element
+         * and returns its end.
+         **/
+        auto SkipElement() -> void;
+    private:
+        friend class XML::BasicParser<XML::Reader>;
+        
+        auto Comment(std::string_view Comment, XML::Location const & StartLocation) -> void;
+        auto ElementStart(XML::Name TagName, XML::Attributes Attributes, XML::Location const & StartLocation) -> void;
+        auto ElementEnd(XML::Name TagName) -> void;
+        auto Text(std::string_view Text, XML::Location const & StartLocation) -> void;
+        
+        XML::Attributes m_Attributes;
+        XML::EventKind m_EventKind;
+        XML::Location m_Location;
+        std::string_view m_Name;
+        XML::SymbolId m_NameId;
+        XML::BasicParser<XML::Reader> m_Parser;
+        bool m_PendingElementEnd;
+        std::string_view m_Text;
+    };
+}
+
+#endif
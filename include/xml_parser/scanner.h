@@ -0,0 +1,81 @@
+/**
+ * Copyright 2026 Hagen Möbius
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+**/
+
+
+#ifndef XML_PARSER__SCANNER_H
+#define XML_PARSER__SCANNER_H
+
+#include <array>
+#include <atomic>
+#include <cassert>
+#include <cstddef>
+#include <string_view>
+
+namespace XML
+{
+    /**
+     * A scanner finds the next occurrence of any of up to eight characters. It compares 32 or 16
+     * characters at once if the processor supports AVX2 or SSE2, which is determined at the first
+     * search. Scanners can be constant-initialized, so they may be used during the dynamic
+     * initialization of other translation units.
+     **/
+    class Scanner
+    {
+    public:
+        using FindFunction = auto (*)(XML::Scanner const & Scanner, char const * Begin, char const * End) -> char const *;
+        
+        constexpr Scanner(std::string_view Needles) :
+            m_Find{XML::Scanner::ResolveFind},
+            m_NeedleCount{Needles.size()},
+            m_Needles{}
+        {
+            assert(Needles.empty() == false);
+            assert(Needles.size() <= m_Needles.size());
+            for(auto Index = std::size_t{0}; Index < Needles.size(); ++Index)
+            {
+                m_Needles[Index] = Needles[Index];
+            }
+        }
+        
+        auto Find(char const * Begin, char const * End) const -> char const *
+        {
+            return m_Find.load(std::memory_order_relaxed)(*this, Begin, End);
+        }
+        
+        auto GetNeedles() const -> char const *
+        {
+            return m_Needles.data();
+        }
+    private:
+        /**
+         * The initial search function, which selects the kernel for the processor, stores it for
+         * the following searches and searches with it.
+         **/
+        static auto ResolveFind(XML::Scanner const & Scanner, char const * Begin, char const * End) -> char const *;
+        
+        mutable std::atomic<FindFunction> m_Find;
+        std::size_t m_NeedleCount;
+        std::array<char, 8> m_Needles;
+    };
+}
+
+#endif
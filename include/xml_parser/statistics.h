@@ -0,0 +1,56 @@
+/**
+ * Copyright 2026 Hagen Möbius
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+**/
+
+#ifndef XML_PARSER__STATISTICS_H
+#define XML_PARSER__STATISTICS_H
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+
+namespace XML
+{
+    /**
+     * Statistics about the work of a parser, which it updates while it parses. They can be read from
+     * within the callbacks, while the parser is suspended and after it has returned. The parse
+     * duration includes the time spent in the callbacks, which is also given separately, so that the
+     * time spent by the parser itself is their difference. Sizes are given in bytes.
+     **/
+    class Statistics
+    {
+    public:
+        std::uint64_t BytesConsumed = 0;
+        std::chrono::nanoseconds CallbackDuration{0};
+        std::uint64_t CommentCount = 0;
+        std::uint64_t Depth = 0;
+        std::uint64_t ElementEndCount = 0;
+        std::uint64_t ElementStartCount = 0;
+        std::uint64_t EntityExpansionCount = 0;
+        std::size_t MaximumAttributeValueSize = 0;
+        std::uint64_t MaximumDepth = 0;
+        std::size_t MaximumTextSize = 0;
+        std::chrono::nanoseconds ParseDuration{0};
+        std::uint64_t TextCount = 0;
+    };
+}
+
+#endif
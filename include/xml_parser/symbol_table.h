@@ -0,0 +1,80 @@
+/**
+ * Copyright 2026 Hagen Möbius
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+**/
+
+#ifndef XML_PARSER__SYMBOL_TABLE_H
+#define XML_PARSER__SYMBOL_TABLE_H
+
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+
+namespace XML
+{
+    using SymbolId = std::uint32_t;
+    
+    /**
+     * The id of names that were not interned, because the parser has no symbol table.
+     **/
+    constexpr auto NoSymbol = XML::SymbolId{0xffffffff};
+    
+    /**
+     * The name of an element or an attribute, together with its id in the parser's symbol table. It
+     * converts to a view of the name, so handlers that are not interested in the id can take a
+     * std::string_view instead.
+     **/
+    class Name
+    {
+    public:
+        std::string_view Text;
+        XML::SymbolId Id;
+        
+        operator std::string_view() const
+        {
+            return Text;
+        }
+    };
+    
+    /**
+     * A symbol table gives every distinct name a stable id, starting at zero in the order in which
+     * the names are interned. An application can intern the names it knows before parsing, so that
+     * it can compare the ids of the parser's events with its own. The names are stored once and
+     * stay valid as long as the table exists.
+     **/
+    class SymbolTable
+    {
+    public:
+        auto Find(std::string_view Name) const -> std::optional<XML::SymbolId>;
+        auto GetName(XML::SymbolId Id) const -> std::string_view;
+        auto GetSize() const -> std::size_t;
+        auto Intern(std::string_view Name) -> XML::SymbolId;
+    private:
+        std::unordered_map<std::string_view, XML::SymbolId> m_Ids;
+        // a deque never moves its elements, so the keys of m_Ids remain valid
+        std::deque<std::string> m_Names;
+    };
+}
+
+#endif
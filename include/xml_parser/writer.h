@@ -0,0 +1,124 @@
+/**
+ * Copyright 2026 Hagen Möbius
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+**/
+
+#ifndef XML_PARSER__WRITER_H
+#define XML_PARSER__WRITER_H
+
+#include <cstddef>
+#include <filesystem>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include <xml_parser/attributes.h>
+
+namespace XML
+{
+    /**
+     * The writer produces a document from the same events that the parser delivers, so that a
+     * handler can pass them on. Texts and attribute values are escaped, comments are written as
+     * they are, and names are neither escaped nor checked. An element without content is written
+     * as a self-closing tag. The writer either appends to a string, which the caller can reuse for
+     * the next document, or collects its output in a buffer and writes it to a file descriptor in
+     * blocks of the buffer size. Runs of characters that do not fit into the buffer are written
+     * directly.
+     **/
+    class Writer
+    {
+    public:
+        Writer(std::string & Output);
+        Writer(int FileDescriptor, std::size_t BufferSize = 1 << 20);
+        Writer(std::filesystem::path const & Path, std::size_t BufferSize = 1 << 20);
+        Writer(XML::Writer const &) = delete;
+        /**
+         * Writes what is left in the buffer, but ignores errors, which only Flush() reports.
+         **/
+        ~Writer();
+        auto operator=(XML::Writer const &) -> XML::Writer & = delete;
+        /**
+         * Adds an attribute to the element that was started last, as long as no content has been
+         * written into it.
+         **/
+        auto Attribute(std::string_view Name, std::string_view Value) -> void;
+        /**
+         * Throws std::invalid_argument if the comment contains "--" or ends with '-', which XML
+         * does not allow.
+         **/
+        auto Comment(std::string_view Comment) -> void;
+        auto ElementEnd() -> void;
+        auto ElementStart(std::string_view TagName, XML::Attributes Attributes = {}) -> void;
+        /**
+         * Writes the buffer to the file descriptor. Throws std::runtime_error if that fails.
+         **/
+        auto Flush() -> void;
+        auto Text(std::string_view Text) -> void;
+    private:
+        /**
+         * Every part of the output goes through here. It is defined in the class, so that it is
+         * inlined also when the library is built position independent.
+         **/
+        auto Append(char const * Begin, char const * End) -> void
+        {
+            if((m_FileDescriptor != -1) && (m_Buffer.size() + static_cast<std::size_t>(End - Begin) > m_BufferSize))
+            {
+                AppendBeyondBuffer(Begin, End);
+            }
+            else
+            {
+                m_Output->append(Begin, static_cast<std::size_t>(End - Begin));
+            }
+        }
+        
+        auto Append(char Character) -> void
+        {
+            if((m_FileDescriptor != -1) && (m_Buffer.size() >= m_BufferSize))
+            {
+                AppendBeyondBuffer(&Character, &Character + 1);
+            }
+            else
+            {
+                m_Output->push_back(Character);
+            }
+        }
+        
+        auto Append(std::string_view Characters) -> void
+        {
+            Append(Characters.data(), Characters.data() + Characters.size());
+        }
+        
+        auto AppendBeyondBuffer(char const * Begin, char const * End) -> void;
+        auto AppendEscaped(std::string_view Characters, bool AttributeValue) -> void;
+        auto CloseStartTag() -> void;
+        auto WriteAll(char const * Begin, char const * End) -> bool;
+        
+        std::size_t m_BufferSize;
+        std::string m_Buffer;
+        int m_FileDescriptor;
+        std::vector<std::size_t> m_NameLengths;
+        std::string m_Names;
+        std::string * m_Output;
+        bool m_OwnsFileDescriptor;
+        bool m_StartTagOpen;
+    };
+}
+
+#endif
@@ -0,0 +1,108 @@
+/**
+ * Copyright 2026 Hagen Möbius
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+**/
+
+
+#include <fcntl.h>
+#include <stdexcept>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <xml_parser/batch_parser.h>
+
+auto XML::Detail::ReadFile(std::filesystem::path const & Path, std::vector<char> & Buffer) -> std::span<char const>
+{
+    auto FileDescriptor = open(Path.c_str(), O_RDONLY);
+    
+    if(FileDescriptor == -1)
+    {
+        throw std::runtime_error{"Could not open the file \"" + Path.string() + "\"."};
+    }
+    
+    struct stat FileStatus;
+    
+    if(fstat(FileDescriptor, &FileStatus) == -1)
+    {
+        close(FileDescriptor);
+        
+        throw std::runtime_error{"Could not determine the size of the file \"" + Path.string() + "\"."};
+    }
+    Buffer.resize(static_cast<std::size_t>(FileStatus.st_size));
+    
+    auto Size = std::size_t{0};
+    
+    while(Size < Buffer.size())
+    {
+        auto const Result = read(FileDescriptor, Buffer.data() + Size, Buffer.size() - Size);
+        
+        if(Result == -1)
+        {
+            close(FileDescriptor);
+            
+            throw std::runtime_error{"Could not read the file \"" + Path.string() + "\"."};
+        }
+        else if(Result == 0)
+        {
+            // the file was truncated after its size was determined
+            break;
+        }
+        Size += static_cast<std::size_t>(Result);
+    }
+    close(FileDescriptor);
+    
+    return {Buffer.data(), Size};
+}
+
+XML::Detail::WorkRanges::WorkRanges(std::size_t Count, unsigned int WorkerCount) :
+    m_Ranges{std::make_unique<Range[]>(WorkerCount)},
+    m_WorkerCount{WorkerCount}
+{
+    for(auto WorkerIndex = 0u; WorkerIndex < WorkerCount; ++WorkerIndex)
+    {
+        m_Ranges[WorkerIndex].Begin = Count * WorkerIndex / WorkerCount;
+        m_Ranges[WorkerIndex].End = Count * (WorkerIndex + 1) / WorkerCount;
+    }
+}
+
+auto XML::Detail::WorkRanges::Pop(unsigned int WorkerIndex) -> std::optional<std::size_t>
+{
+    {
+        auto & Range = m_Ranges[WorkerIndex];
+        auto Lock = std::unique_lock{Range.Mutex};
+        
+        if(Range.Begin < Range.End)
+        {
+            return Range.Begin++;
+        }
+    }
+    for(auto Offset = 1u; Offset < m_WorkerCount; ++Offset)
+    {
+        auto & Range = m_Ranges[(WorkerIndex + Offset) % m_WorkerCount];
+        auto Lock = std::unique_lock{Range.Mutex};
+        
+        if(Range.Begin < Range.End)
+        {
+            return --Range.End;
+        }
+    }
+    
+    return std::nullopt;
+}
@@ -0,0 +1,185 @@
+/**
+ * Copyright 2026 Hagen Möbius
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+**/
+
+
+#include <algorithm>
+#include <climits>
+#include <stdexcept>
+
+#define ZLIB_CONST
+#include <zlib.h>
+
+#include <xml_parser/compressed_input_source.h>
+
+XML::CompressedFileInputSource::CompressedFileInputSource(std::filesystem::path const & Path, std::size_t BlockSize, std::size_t BlockCount) :
+    m_BlockSizes(BlockCount, 0),
+    m_Blocks(BlockCount, std::vector<char>(BlockSize)),
+    m_File{Path},
+    m_FilledCount{0},
+    m_Finished{false},
+    m_Path{Path},
+    m_ReadCount{0},
+    m_Stopping{false}
+{
+    if((BlockSize == 0) || (BlockCount < 2))
+    {
+        throw std::invalid_argument{"A compressed file input source needs at least two blocks of a size other than zero."};
+    }
+    
+    auto const Data = m_File.GetData();
+    
+    if((Data.size() >= 4) && (static_cast<unsigned char>(Data[0]) == 0x28) && (static_cast<unsigned char>(Data[1]) == 0xb5) && (static_cast<unsigned char>(Data[2]) == 0x2f) && (static_cast<unsigned char>(Data[3]) == 0xfd))
+    {
+        throw std::runtime_error{"The file \"" + Path.string() + "\" is compressed with zstd, which is not supported."};
+    }
+    m_Thread = std::thread{&XML::CompressedFileInputSource::Decompress, this};
+}
+
+XML::CompressedFileInputSource::~CompressedFileInputSource()
+{
+    {
+        auto Lock = std::lock_guard{m_Mutex};
+        
+        m_Stopping = true;
+    }
+    m_Changed.notify_all();
+    m_Thread.join();
+}
+
+auto XML::CompressedFileInputSource::Read() -> std::span<char const>
+{
+    auto Lock = std::unique_lock{m_Mutex};
+    
+    m_Changed.wait(Lock, [this]() { return (m_ReadCount < m_FilledCount) || (m_Finished == true); });
+    if(m_ReadCount < m_FilledCount)
+    {
+        auto const Index = m_ReadCount % m_Blocks.size();
+        
+        // taking the next block gives the one handed out by the previous call back to the ring
+        ++m_ReadCount;
+        m_Changed.notify_all();
+        
+        return {m_Blocks[Index].data(), m_BlockSizes[Index]};
+    }
+    else if(m_Exception != nullptr)
+    {
+        std::rethrow_exception(m_Exception);
+    }
+    else
+    {
+        return {};
+    }
+}
+
+auto XML::CompressedFileInputSource::Decompress() -> void
+{
+    auto Input = m_File.GetData();
+    auto Stream = z_stream{};
+    
+    if(inflateInit2(&Stream, 15 + 32) != Z_OK)
+    {
+        auto Lock = std::lock_guard{m_Mutex};
+        
+        m_Exception = std::make_exception_ptr(std::runtime_error{"Could not initialize the decompression of the file \"" + m_Path.string() + "\"."});
+        m_Finished = true;
+        m_Changed.notify_all();
+        
+        return;
+    }
+    try
+    {
+        auto Ended = false;
+        
+        while(Ended == false)
+        {
+            auto Index = std::size_t{0};
+            
+            {
+                auto Lock = std::unique_lock{m_Mutex};
+                
+                // the parser still holds the block of its last Read(), which is the one before m_ReadCount
+                m_Changed.wait(Lock, [this]() { return (m_Stopping == true) || (m_FilledCount + 1 < m_ReadCount + m_Blocks.size()) || ((m_ReadCount == 0) && (m_FilledCount < m_Blocks.size())); });
+                if(m_Stopping == true)
+                {
+                    break;
+                }
+                Index = m_FilledCount % m_Blocks.size();
+            }
+            
+            auto & Block = m_Blocks[Index];
+            
+            Stream.next_out = reinterpret_cast<Bytef *>(Block.data());
+            Stream.avail_out = static_cast<uInt>(std::min(Block.size(), static_cast<std::size_t>(UINT_MAX)));
+            while((Ended == false) && (Stream.avail_out > 0))
+            {
+                if(Stream.avail_in == 0)
+                {
+                    if(Input.empty() == true)
+                    {
+                        throw std::runtime_error{"The file \"" + m_Path.string() + "\" ends inside its compressed data."};
+                    }
+                    
+                    auto const Size = std::min(Input.size(), static_cast<std::size_t>(UINT_MAX));
+                    
+                    Stream.next_in = reinterpret_cast<Bytef const *>(Input.data());
+                    Stream.avail_in = static_cast<uInt>(Size);
+                    Input = Input.subspan(Size);
+                }
+                
+                auto const Result = inflate(&Stream, Z_NO_FLUSH);
+                
+                if(Result == Z_STREAM_END)
+                {
+                    if((Stream.avail_in == 0) && (Input.empty() == true))
+                    {
+                        Ended = true;
+                    }
+                    else
+                    {
+                        // another gzip member follows
+                        inflateReset(&Stream);
+                    }
+                }
+                else if(Result != Z_OK)
+                {
+                    throw std::runtime_error{"The file \"" + m_Path.string() + "\" does not contain valid gzip or zlib data."};
+                }
+            }
+            
+            auto Lock = std::lock_guard{m_Mutex};
+            
+            m_BlockSizes[Index] = static_cast<std::size_t>(reinterpret_cast<char *>(Stream.next_out) - Block.data());
+            ++m_FilledCount;
+            m_Finished = Ended;
+            m_Changed.notify_all();
+        }
+    }
+    catch(std::exception const &)
+    {
+        auto Lock = std::lock_guard{m_Mutex};
+        
+        m_Exception = std::current_exception();
+        m_Finished = true;
+        m_Changed.notify_all();
+    }
+    inflateEnd(&Stream);
+}
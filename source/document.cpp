@@ -0,0 +1,277 @@
+/**
+ * Copyright 2026 Hagen Möbius
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+**/
+
+
+#include <cassert>
+#include <stdexcept>
+
+#include <xml_parser/document.h>
+
+XML::Node::Node(XML::Document const & Document, std::uint32_t Index) :
+    m_Document{&Document},
+    m_Index{Index}
+{
+}
+
+auto XML::Node::FindAttribute(std::string_view Name) const -> std::optional<std::string_view>
+{
+    for(auto Index = std::uint32_t{0}; Index < GetAttributeCount(); ++Index)
+    {
+        auto const Attribute = GetAttribute(Index);
+        
+        if(Attribute.Name == Name)
+        {
+            return Attribute.Value;
+        }
+    }
+    
+    return std::nullopt;
+}
+
+auto XML::Node::GetAttribute(std::uint32_t Index) const -> XML::Attribute
+{
+    auto const & Node = m_Document->m_Nodes[m_Index];
+    
+    assert(Index < Node.AttributeCount);
+    
+    auto const & Attribute = m_Document->m_Attributes[Node.AttributeBegin + Index];
+    
+    return XML::Attribute{m_Document->GetString(Attribute.NameOffset, Attribute.NameLength), m_Document->GetString(Attribute.ValueOffset, Attribute.ValueLength)};
+}
+
+auto XML::Node::GetAttributeCount() const -> std::uint32_t
+{
+    return m_Document->m_Nodes[m_Index].AttributeCount;
+}
+
+auto XML::Node::GetFirstChild() const -> std::optional<XML::Node>
+{
+    auto const FirstChild = m_Document->m_Nodes[m_Index].FirstChild;
+    
+    if(FirstChild == XML::Document::NoNode)
+    {
+        return std::nullopt;
+    }
+    else
+    {
+        return XML::Node{*m_Document, FirstChild};
+    }
+}
+
+auto XML::Node::GetKind() const -> XML::NodeKind
+{
+    return m_Document->m_Nodes[m_Index].Kind;
+}
+
+auto XML::Node::GetLocation() const -> XML::Location const &
+{
+    return m_Document->m_Nodes[m_Index].Location;
+}
+
+auto XML::Node::GetName() const -> std::string_view
+{
+    auto const & Node = m_Document->m_Nodes[m_Index];
+    
+    assert(Node.Kind == XML::NodeKind::Element);
+    
+    return m_Document->GetString(Node.ContentOffset, Node.ContentLength);
+}
+
+auto XML::Node::GetNextSibling() const -> std::optional<XML::Node>
+{
+    auto const NextSibling = m_Document->m_Nodes[m_Index].NextSibling;
+    
+    if(NextSibling == XML::Document::NoNode)
+    {
+        return std::nullopt;
+    }
+    else
+    {
+        return XML::Node{*m_Document, NextSibling};
+    }
+}
+
+auto XML::Node::GetParent() const -> std::optional<XML::Node>
+{
+    auto const Parent = m_Document->m_Nodes[m_Index].Parent;
+    
+    if(Parent == XML::Document::NoNode)
+    {
+        return std::nullopt;
+    }
+    else
+    {
+        return XML::Node{*m_Document, Parent};
+    }
+}
+
+auto XML::Node::GetText() const -> std::string_view
+{
+    auto const & Node = m_Document->m_Nodes[m_Index];
+    
+    assert((Node.Kind == XML::NodeKind::Comment) || (Node.Kind == XML::NodeKind::Text));
+    
+    return m_Document->GetString(Node.ContentOffset, Node.ContentLength);
+}
+
+XML::Document::Document()
+{
+    Clear();
+}
+
+auto XML::Document::AppendString(std::string_view String) -> std::uint32_t
+{
+    if(m_Strings.size() + String.size() > NoNode)
+    {
+        throw std::length_error{"The strings of the document exceed 4 GiB."};
+    }
+    
+    auto const Result = static_cast<std::uint32_t>(m_Strings.size());
+    
+    m_Strings += String;
+    
+    return Result;
+}
+
+auto XML::Document::Clear() -> void
+{
+    m_Attributes.clear();
+    m_Nodes.clear();
+    m_Strings.clear();
+    m_Nodes.push_back(NodeRecord{0, 0, 0, 0, NoNode, XML::NodeKind::Document, XML::Location{0, 0, 0}, NoNode, NoNode});
+}
+
+auto XML::Document::GetNodeCount() const -> std::size_t
+{
+    return m_Nodes.size();
+}
+
+auto XML::Document::GetRoot() const -> XML::Node
+{
+    return XML::Node{*this, 0};
+}
+
+auto XML::Document::GetString(std::uint32_t Offset, std::uint32_t Length) const -> std::string_view
+{
+    return std::string_view{m_Strings}.substr(Offset, Length);
+}
+
+XML::DocumentBuilder::DocumentBuilder(XML::Document & Document) :
+    m_Document{Document}
+{
+    Initialize();
+}
+
+XML::DocumentBuilder::DocumentBuilder(XML::Document & Document, std::istream & InputStream) :
+    XML::Parser{InputStream},
+    m_Document{Document}
+{
+    Initialize();
+}
+
+XML::DocumentBuilder::DocumentBuilder(XML::Document & Document, std::span<char const> Data) :
+    XML::Parser{Data},
+    m_Document{Document}
+{
+    Initialize();
+}
+
+XML::DocumentBuilder::DocumentBuilder(XML::Document & Document, std::filesystem::path const & Path) :
+    XML::Parser{Path},
+    m_Document{Document}
+{
+    Initialize();
+}
+
+XML::DocumentBuilder::DocumentBuilder(XML::Document & Document, std::unique_ptr<XML::InputSource> InputSource) :
+    XML::Parser{std::move(InputSource)},
+    m_Document{Document}
+{
+    Initialize();
+}
+
+auto XML::DocumentBuilder::AppendNode(XML::NodeKind Kind, std::string_view Content, XML::Location const & Location) -> std::uint32_t
+{
+    if(m_Document.m_Nodes.size() == XML::Document::NoNode)
+    {
+        throw std::length_error{"The document has too many nodes."};
+    }
+    
+    auto const Index = static_cast<std::uint32_t>(m_Document.m_Nodes.size());
+    auto const Parent = m_OpenElements.back();
+    
+    m_Document.m_Nodes.push_back(XML::Document::NodeRecord{static_cast<std::uint32_t>(m_Document.m_Attributes.size()), 0, static_cast<std::uint32_t>(Content.size()), m_Document.AppendString(Content), XML::Document::NoNode, Kind, Location, XML::Document::NoNode, Parent});
+    if(m_LastChildren.back() == XML::Document::NoNode)
+    {
+        m_Document.m_Nodes[Parent].FirstChild = Index;
+    }
+    else
+    {
+        m_Document.m_Nodes[m_LastChildren.back()].NextSibling = Index;
+    }
+    m_LastChildren.back() = Index;
+    
+    return Index;
+}
+
+auto XML::DocumentBuilder::CommentView(std::string_view Comment, XML::Location const & StartLocation) -> void
+{
+    AppendNode(XML::NodeKind::Comment, Comment, StartLocation);
+}
+
+auto XML::DocumentBuilder::ElementStartView(std::string_view TagName, XML::Attributes Attributes, XML::Location const & StartLocation) -> void
+{
+    auto const Index = AppendNode(XML::NodeKind::Element, TagName, StartLocation);
+    
+    for(auto & Attribute : Attributes)
+    {
+        auto const NameOffset = m_Document.AppendString(Attribute.Name);
+        auto const ValueOffset = m_Document.AppendString(Attribute.Value);
+        
+        m_Document.m_Attributes.push_back(XML::Document::AttributeRecord{static_cast<std::uint32_t>(Attribute.Name.size()), NameOffset, static_cast<std::uint32_t>(Attribute.Value.size()), ValueOffset});
+    }
+    m_Document.m_Nodes[Index].AttributeCount = static_cast<std::uint32_t>(Attributes.size());
+    m_OpenElements.push_back(Index);
+    m_LastChildren.push_back(XML::Document::NoNode);
+}
+
+auto XML::DocumentBuilder::ElementEndView(std::string_view) -> void
+{
+    // the document node itself is never closed
+    if(m_OpenElements.size() > 1)
+    {
+        m_OpenElements.pop_back();
+        m_LastChildren.pop_back();
+    }
+}
+
+auto XML::DocumentBuilder::Initialize() -> void
+{
+    m_Document.Clear();
+    m_OpenElements.push_back(0);
+    m_LastChildren.push_back(XML::Document::NoNode);
+}
+
+auto XML::DocumentBuilder::TextView(std::string_view Text, XML::Location const & StartLocation) -> void
+{
+    AppendNode(XML::NodeKind::Text, Text, StartLocation);
+}
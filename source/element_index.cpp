@@ -0,0 +1,231 @@
+/**
+ * Copyright 2026 Hagen Möbius
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+**/
+
+#include <fstream>
+#include <iterator>
+#include <stdexcept>
+
+#include <xml_parser/element_index.h>
+#include <xml_parser/numbers.h>
+
+/**
+ * The file starts with a signature and a version. The paths follow in the order in which they
+ * first occurred, each with its offsets. The offsets are stored as the differences to the previous
+ * offset of the same path.
+ **/
+namespace
+{
+    constexpr auto Signature = std::string_view{"XMLINDEX"};
+    constexpr auto Version = std::uint64_t{1};
+}
+
+XML::ElementIndex::ElementIndex(std::size_t MaximumDepth) :
+    m_Depth{0},
+    m_MaximumDepth{MaximumDepth}
+{
+}
+
+auto XML::ElementIndex::Clear() -> void
+{
+    m_Depth = 0;
+    m_Offsets.clear();
+    m_Path.clear();
+    m_PathIndices.clear();
+    m_PathLengths.clear();
+    m_Paths.clear();
+}
+
+auto XML::ElementIndex::ElementEnd() -> void
+{
+    // a stray end tag at document level has no element to close
+    if(m_Depth == 0)
+    {
+        return;
+    }
+    if(m_Depth <= m_MaximumDepth)
+    {
+        m_Path.resize(m_PathLengths.back());
+        m_PathLengths.pop_back();
+    }
+    m_Depth -= 1;
+}
+
+auto XML::ElementIndex::ElementStart(std::string_view Name, std::uint64_t Offset) -> void
+{
+    m_Depth += 1;
+    if(m_Depth <= m_MaximumDepth)
+    {
+        m_PathLengths.push_back(m_Path.size());
+        m_Path += '/';
+        m_Path += Name;
+        
+        auto Iterator = m_PathIndices.find(m_Path);
+        
+        if(Iterator == m_PathIndices.end())
+        {
+            // the deque keeps the paths in place, so the keys of the map stay valid
+            m_Paths.push_back(m_Path);
+            m_Offsets.emplace_back();
+            Iterator = m_PathIndices.emplace(m_Paths.back(), m_Paths.size() - 1).first;
+        }
+        m_Offsets[Iterator->second].push_back(Offset);
+    }
+}
+
+auto XML::ElementIndex::Find(std::string_view Path, std::uint64_t Ordinal) const -> std::optional<std::uint64_t>
+{
+    auto const Iterator = m_PathIndices.find(Path);
+    
+    if((Iterator != m_PathIndices.end()) && (Ordinal < m_Offsets[Iterator->second].size()))
+    {
+        return m_Offsets[Iterator->second][Ordinal];
+    }
+    else
+    {
+        return std::nullopt;
+    }
+}
+
+auto XML::ElementIndex::GetCount(std::string_view Path) const -> std::uint64_t
+{
+    auto const Iterator = m_PathIndices.find(Path);
+    
+    if(Iterator != m_PathIndices.end())
+    {
+        return m_Offsets[Iterator->second].size();
+    }
+    else
+    {
+        return 0;
+    }
+}
+
+auto XML::ElementIndex::GetPaths() const -> std::deque<std::string> const &
+{
+    return m_Paths;
+}
+
+auto XML::ElementIndex::Load(std::filesystem::path const & Path) -> void
+{
+    auto File = std::ifstream{Path, std::ios::binary};
+    
+    if(File.is_open() == false)
+    {
+        throw std::runtime_error{"Could not open the file \"" + Path.string() + "\"."};
+    }
+    
+    auto const Content = std::string{std::istreambuf_iterator<char>{File}, std::istreambuf_iterator<char>{}};
+    auto const Invalid = std::runtime_error{"The file \"" + Path.string() + "\" is not an element index."};
+    auto Buffer = std::string_view{Content};
+    
+    Clear();
+    if(Buffer.starts_with(Signature) == false)
+    {
+        throw Invalid;
+    }
+    Buffer.remove_prefix(Signature.size());
+    if(XML::Detail::ReadNumber(Buffer) != Version)
+    {
+        throw Invalid;
+    }
+    
+    auto const PathCount = XML::Detail::ReadNumber(Buffer);
+    
+    if(PathCount.has_value() == false)
+    {
+        throw Invalid;
+    }
+    for(auto PathIndex = std::uint64_t{0}; PathIndex < PathCount.value(); ++PathIndex)
+    {
+        auto const PathLength = XML::Detail::ReadNumber(Buffer);
+        
+        if((PathLength.has_value() == false) || (PathLength.value() > Buffer.size()))
+        {
+            Clear();
+            
+            throw Invalid;
+        }
+        m_Paths.emplace_back(Buffer.substr(0, PathLength.value()));
+        Buffer.remove_prefix(PathLength.value());
+        m_PathIndices.emplace(m_Paths.back(), m_Paths.size() - 1);
+        
+        auto & Offsets = m_Offsets.emplace_back();
+        auto const OffsetCount = XML::Detail::ReadNumber(Buffer);
+        auto Offset = std::uint64_t{0};
+        
+        // every offset takes at least one byte, which bounds the count before anything is allocated
+        if((OffsetCount.has_value() == false) || (OffsetCount.value() > Buffer.size()))
+        {
+            Clear();
+            
+            throw Invalid;
+        }
+        Offsets.reserve(OffsetCount.value());
+        for(auto OffsetIndex = std::uint64_t{0}; OffsetIndex < OffsetCount.value(); ++OffsetIndex)
+        {
+            auto const Difference = XML::Detail::ReadNumber(Buffer);
+            
+            if(Difference.has_value() == false)
+            {
+                Clear();
+                
+                throw Invalid;
+            }
+            Offset += Difference.value();
+            Offsets.push_back(Offset);
+        }
+    }
+    if(Buffer.empty() == false)
+    {
+        Clear();
+        
+        throw Invalid;
+    }
+}
+
+auto XML::ElementIndex::Save(std::filesystem::path const & Path) const -> void
+{
+    auto Buffer = std::string{Signature};
+    
+    XML::Detail::AppendNumber(Buffer, Version);
+    XML::Detail::AppendNumber(Buffer, m_Paths.size());
+    for(auto PathIndex = std::size_t{0}; PathIndex < m_Paths.size(); ++PathIndex)
+    {
+        auto Previous = std::uint64_t{0};
+        
+        XML::Detail::AppendNumber(Buffer, m_Paths[PathIndex].size());
+        Buffer += m_Paths[PathIndex];
+        XML::Detail::AppendNumber(Buffer, m_Offsets[PathIndex].size());
+        for(auto Offset : m_Offsets[PathIndex])
+        {
+            XML::Detail::AppendNumber(Buffer, Offset - Previous);
+            Previous = Offset;
+        }
+    }
+    
+    auto File = std::ofstream{Path, std::ios::binary | std::ios::trunc};
+    
+    if((File.is_open() == false) || (File.write(Buffer.data(), Buffer.size()).flush().good() == false))
+    {
+        throw std::runtime_error{"Could not write the file \"" + Path.string() + "\"."};
+    }
+}
@@ -0,0 +1,65 @@
+/**
+ * Copyright 2026 Hagen Möbius
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+**/
+
+
+#include <xml_parser/entities.h>
+
+auto XML::DecodeEntities(std::string_view Text, std::string & Buffer) -> std::string_view
+{
+    auto Ampersand = Text.find('&');
+    
+    if(Ampersand == std::string_view::npos)
+    {
+        return Text;
+    }
+    auto CharacterBuffer = std::array<char, 4>{};
+    
+    Buffer.clear();
+    while(Ampersand != std::string_view::npos)
+    {
+        Buffer += Text.substr(0, Ampersand);
+        Text.remove_prefix(Ampersand);
+        
+        auto const Semicolon = Text.find(';');
+        
+        if(Semicolon == std::string_view::npos)
+        {
+            break;
+        }
+        
+        auto const Replacement = XML::Detail::DecodeEntity(Text.substr(1, Semicolon - 1), CharacterBuffer);
+        
+        if(Replacement.empty() == false)
+        {
+            Buffer += Replacement;
+        }
+        else
+        {
+            Buffer += Text.substr(0, Semicolon + 1);
+        }
+        Text.remove_prefix(Semicolon + 1);
+        Ampersand = Text.find('&');
+    }
+    Buffer += Text;
+    
+    return Buffer;
+}
@@ -0,0 +1,391 @@
+/**
+ * Copyright 2026 Hagen Möbius
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+**/
+
+#include <array>
+#include <cstring>
+#include <fstream>
+#include <stdexcept>
+#include <string>
+
+#include <xml_parser/basic_parser.h>
+#include <xml_parser/event_cache.h>
+#include <xml_parser/numbers.h>
+#include <xml_parser/symbol_table.h>
+
+/**
+ * The file starts with a signature, a version, the size and the hash of the document and the
+ * names, each with its length. The events follow up to the end of the file, each starting with
+ * its code. Comments and texts carry their location and their content, element starts their
+ * name, their location and their attributes, and element ends their name. Apart from the codes,
+ * everything is stored as numbers or as strings prefixed with their lengths.
+ **/
+namespace
+{
+    constexpr auto Signature = std::string_view{"XMLEVENT"};
+    constexpr auto Version = std::uint64_t{1};
+    
+    enum class EventCode : std::uint8_t
+    {
+        Comment = 0,
+        ElementEnd = 1,
+        ElementStart = 2,
+        Text = 3
+    };
+    
+    auto AppendLocation(std::string & Buffer, XML::Location const & Location) -> void
+    {
+        XML::Detail::AppendNumber(Buffer, Location.Column);
+        XML::Detail::AppendNumber(Buffer, Location.Line);
+        XML::Detail::AppendNumber(Buffer, Location.Offset);
+    }
+    
+    auto AppendString(std::string & Buffer, std::string_view String) -> void
+    {
+        XML::Detail::AppendNumber(Buffer, String.size());
+        Buffer += String;
+    }
+    
+    auto ReadNumber(std::string_view & Buffer) -> std::uint64_t
+    {
+        auto const Result = XML::Detail::ReadNumber(Buffer);
+        
+        if(Result.has_value() == false)
+        {
+            throw std::runtime_error{"The event cache is corrupt."};
+        }
+        
+        return Result.value();
+    }
+    
+    auto ReadLocation(std::string_view & Buffer) -> XML::Location
+    {
+        auto const Column = ReadNumber(Buffer);
+        auto const Line = ReadNumber(Buffer);
+        
+        return XML::Location{Column, Line, ReadNumber(Buffer)};
+    }
+    
+    auto ReadString(std::string_view & Buffer) -> std::string_view
+    {
+        auto const Length = ReadNumber(Buffer);
+        
+        if(Length > Buffer.size())
+        {
+            throw std::runtime_error{"The event cache is corrupt."};
+        }
+        
+        auto const Result = Buffer.substr(0, Length);
+        
+        Buffer.remove_prefix(Length);
+        
+        return Result;
+    }
+    
+    /**
+     * Writes the events of the basic parser into the buffer. The parser interns the names into
+     * a symbol table, so that their ids are the indices of the names in the cache.
+     **/
+    class EventCacheRecorder
+    {
+    public:
+        EventCacheRecorder(std::string & Buffer) :
+            m_Buffer{Buffer}
+        {
+        }
+        
+        auto Comment(std::string_view Comment, XML::Location const & StartLocation) -> void
+        {
+            m_Buffer += static_cast<char>(EventCode::Comment);
+            AppendLocation(m_Buffer, StartLocation);
+            AppendString(m_Buffer, Comment);
+        }
+        
+        auto ElementEnd(XML::Name TagName) -> void
+        {
+            m_Buffer += static_cast<char>(EventCode::ElementEnd);
+            XML::Detail::AppendNumber(m_Buffer, TagName.Id);
+        }
+        
+        auto ElementStart(XML::Name TagName, XML::Attributes Attributes, XML::Location const & StartLocation) -> void
+        {
+            m_Buffer += static_cast<char>(EventCode::ElementStart);
+            XML::Detail::AppendNumber(m_Buffer, TagName.Id);
+            AppendLocation(m_Buffer, StartLocation);
+            XML::Detail::AppendNumber(m_Buffer, Attributes.size());
+            for(auto const & Attribute : Attributes)
+            {
+                XML::Detail::AppendNumber(m_Buffer, Attribute.NameId);
+                AppendString(m_Buffer, Attribute.Value);
+            }
+        }
+        
+        auto Text(std::string_view Text, XML::Location const & StartLocation) -> void
+        {
+            m_Buffer += static_cast<char>(EventCode::Text);
+            AppendLocation(m_Buffer, StartLocation);
+            AppendString(m_Buffer, Text);
+        }
+    private:
+        std::string & m_Buffer;
+    };
+}
+
+/**
+ * Four independent lanes take eight bytes each per step, so that the multiplications overlap.
+ **/
+auto XML::Detail::HashContent(std::span<char const> Content) -> std::uint64_t
+{
+    constexpr auto Multiplier = std::uint64_t{0x9e3779b97f4a7c15};
+    auto Lanes = std::array<std::uint64_t, 4>{0x243f6a8885a308d3, 0x13198a2e03707344, 0xa4093822299f31d0, 0x082efa98ec4e6c89};
+    auto Data = Content.data();
+    auto const End = Content.data() + Content.size();
+    
+    for(; End - Data >= 32; Data += 32)
+    {
+        for(auto Lane = std::size_t{0}; Lane < Lanes.size(); ++Lane)
+        {
+            auto Word = std::uint64_t{};
+            
+            std::memcpy(&Word, Data + Lane * 8, 8);
+            Lanes[Lane] = (Lanes[Lane] ^ Word) * Multiplier;
+            Lanes[Lane] ^= Lanes[Lane] >> 29;
+        }
+    }
+    
+    auto Result = Content.size() * Multiplier;
+    
+    for(auto Lane : Lanes)
+    {
+        Result = (Result ^ Lane) * Multiplier;
+        Result ^= Result >> 32;
+    }
+    for(; Data != End; ++Data)
+    {
+        Result = (Result ^ static_cast<unsigned char>(*Data)) * Multiplier;
+        Result ^= Result >> 32;
+    }
+    
+    return Result;
+}
+
+XML::EventCache::EventCache(std::filesystem::path const & Path) :
+    m_DocumentHash{0},
+    m_DocumentSize{0},
+    m_File{Path}
+{
+    auto const Invalid = std::runtime_error{"The file \"" + Path.string() + "\" is not an event cache of this version."};
+    auto Buffer = std::string_view{m_File.GetData().data(), m_File.GetData().size()};
+    auto const Read = [&Buffer, &Invalid]()
+    {
+        auto const Result = XML::Detail::ReadNumber(Buffer);
+        
+        if(Result.has_value() == false)
+        {
+            throw Invalid;
+        }
+        
+        return Result.value();
+    };
+    
+    if(Buffer.starts_with(Signature) == false)
+    {
+        throw Invalid;
+    }
+    Buffer.remove_prefix(Signature.size());
+    if(Read() != Version)
+    {
+        throw Invalid;
+    }
+    m_DocumentSize = Read();
+    m_DocumentHash = Read();
+    
+    auto const NameCount = Read();
+    
+    // every name takes at least one byte, which bounds the count before anything is allocated
+    if(NameCount > Buffer.size())
+    {
+        throw Invalid;
+    }
+    m_Names.reserve(NameCount);
+    for(auto Index = std::uint64_t{0}; Index < NameCount; ++Index)
+    {
+        auto const Length = Read();
+        
+        if(Length > Buffer.size())
+        {
+            throw Invalid;
+        }
+        m_Names.push_back(Buffer.substr(0, Length));
+        Buffer.remove_prefix(Length);
+    }
+    m_Events = Buffer;
+}
+
+auto XML::EventCache::Matches(std::span<char const> Document) const -> bool
+{
+    return (Document.size() == m_DocumentSize) && (XML::Detail::HashContent(Document) == m_DocumentHash);
+}
+
+auto XML::EventCache::Record(std::span<char const> Document, std::filesystem::path const & Path) -> void
+{
+    auto Events = std::string{};
+    auto Recorder = EventCacheRecorder{Events};
+    auto SymbolTable = XML::SymbolTable{};
+    auto Parser = XML::BasicParser<EventCacheRecorder>{Recorder, Document};
+    
+    Parser.SetSymbolTable(&SymbolTable);
+    Parser.Parse();
+    
+    auto Header = std::string{Signature};
+    
+    XML::Detail::AppendNumber(Header, Version);
+    XML::Detail::AppendNumber(Header, Document.size());
+    XML::Detail::AppendNumber(Header, XML::Detail::HashContent(Document));
+    XML::Detail::AppendNumber(Header, SymbolTable.GetSize());
+    for(auto Id = XML::SymbolId{0}; Id < SymbolTable.GetSize(); ++Id)
+    {
+        AppendString(Header, SymbolTable.GetName(Id));
+    }
+    
+    auto File = std::ofstream{Path, std::ios::binary | std::ios::trunc};
+    
+    if((File.is_open() == false) || (File.write(Header.data(), Header.size()).write(Events.data(), Events.size()).flush().good() == false))
+    {
+        throw std::runtime_error{"Could not write the file \"" + Path.string() + "\"."};
+    }
+}
+
+auto XML::EventCache::GetName(std::size_t Index) const -> std::string_view
+{
+    return m_Names[Index];
+}
+
+auto XML::EventCache::GetNameCount() const -> std::size_t
+{
+    return m_Names.size();
+}
+
+auto XML::EventCache::Next(std::size_t & Position, XML::Detail::CachedEvent & Event) const -> bool
+{
+    if(Position == m_Events.size())
+    {
+        return false;
+    }
+    
+    auto Buffer = m_Events.substr(Position);
+    auto const ReadNameIndex = [this, &Buffer]()
+    {
+        auto const Result = ReadNumber(Buffer);
+        
+        if(Result >= m_Names.size())
+        {
+            throw std::runtime_error{"The event cache is corrupt."};
+        }
+        
+        return static_cast<std::size_t>(Result);
+    };
+    auto const Code = static_cast<EventCode>(Buffer.front());
+    
+    Buffer.remove_prefix(1);
+    switch(Code)
+    {
+    case EventCode::Comment:
+        {
+            Event.Kind = XML::EventKind::Comment;
+            Event.Location = ReadLocation(Buffer);
+            Event.Text = ReadString(Buffer);
+            
+            break;
+        }
+    case EventCode::ElementEnd:
+        {
+            Event.Kind = XML::EventKind::ElementEnd;
+            Event.NameIndex = ReadNameIndex();
+            
+            break;
+        }
+    case EventCode::ElementStart:
+        {
+            Event.Kind = XML::EventKind::ElementStart;
+            Event.NameIndex = ReadNameIndex();
+            Event.Location = ReadLocation(Buffer);
+            
+            auto const AttributeCount = ReadNumber(Buffer);
+            
+            // every attribute takes at least two bytes
+            if(AttributeCount > Buffer.size() / 2)
+            {
+                throw std::runtime_error{"The event cache is corrupt."};
+            }
+            Event.Attributes.resize(AttributeCount);
+            for(auto & Attribute : Event.Attributes)
+            {
+                auto const NameIndex = ReadNameIndex();
+                
+                Attribute.Name = m_Names[NameIndex];
+                Attribute.NameId = static_cast<XML::SymbolId>(NameIndex);
+                Attribute.Value = ReadString(Buffer);
+            }
+            
+            break;
+        }
+    case EventCode::Text:
+        {
+            Event.Kind = XML::EventKind::Text;
+            Event.Location = ReadLocation(Buffer);
+            Event.Text = ReadString(Buffer);
+            
+            break;
+        }
+    default:
+        {
+            throw std::runtime_error{"The event cache is corrupt."};
+        }
+    }
+    Position = m_Events.size() - Buffer.size();
+    
+    return true;
+}
+
+auto XML::EventCache::SkipElement(std::size_t & Position, XML::Detail::CachedEvent & Event) const -> void
+{
+    auto Depth = std::size_t{1};
+    
+    for(auto EventPosition = Position; Next(Position, Event) == true; EventPosition = Position)
+    {
+        if(Event.Kind == XML::EventKind::ElementStart)
+        {
+            Depth += 1;
+        }
+        else if(Event.Kind == XML::EventKind::ElementEnd)
+        {
+            Depth -= 1;
+            if(Depth == 0)
+            {
+                // the end event is delivered as usual
+                Position = EventPosition;
+                
+                break;
+            }
+        }
+    }
+}
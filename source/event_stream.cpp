@@ -0,0 +1,46 @@
+/**
+ * Copyright 2026 Hagen Möbius
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+**/
+
+#include <utility>
+
+#include <xml_parser/event_stream.h>
+
+auto XML::ReadEvents(XML::Reader & Reader) -> XML::Generator<XML::Event>
+{
+    while(Reader.Next() != XML::EventKind::End)
+    {
+        co_yield XML::Event{Reader.GetAttributes(), Reader.GetEventKind(), Reader.GetLocation(), XML::Name{Reader.GetName(), Reader.GetNameId()}, Reader.GetText()};
+    }
+}
+
+/**
+ * The reader lives in the coroutine's frame, as long as the generator.
+ **/
+auto XML::ReadEvents(std::unique_ptr<XML::InputSource> InputSource) -> XML::Generator<XML::Event>
+{
+    auto Reader = XML::Reader{std::move(InputSource)};
+    
+    for(auto const & Event : ReadEvents(Reader))
+    {
+        co_yield Event;
+    }
+}
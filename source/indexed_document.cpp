@@ -0,0 +1,62 @@
+/**
+ * Copyright 2026 Hagen Möbius
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+**/
+
+#include <algorithm>
+#include <stdexcept>
+
+#include <xml_parser/indexed_document.h>
+
+XML::IndexedDocument::IndexedDocument(std::filesystem::path const & DocumentPath, std::filesystem::path const & IndexPath) :
+    m_Document{DocumentPath}
+{
+    m_Index.Load(IndexPath);
+}
+
+auto XML::IndexedDocument::GetIndex() const -> XML::ElementIndex const &
+{
+    return m_Index;
+}
+
+/**
+ * Checks that the start tag of the element is at the indexed offset, which catches nearly all
+ * changes of the document, before the parser is started somewhere in the middle of a tag or text.
+ **/
+auto XML::IndexedDocument::Locate(std::string_view Path, std::uint64_t Ordinal) const -> std::optional<std::uint64_t>
+{
+    auto const Offset = m_Index.Find(Path, Ordinal);
+    
+    if(Offset.has_value() == true)
+    {
+        auto const Data = std::string_view{m_Document.GetData().data(), m_Document.GetData().size()};
+        auto const Name = Path.substr(Path.rfind('/') + 1);
+        // the parser allows whitespace between the '<' and the name
+        auto const NameBegin = std::min(Data.find_first_not_of(" \t\n", Offset.value() + 1), Data.size());
+        auto const NameEnd = NameBegin + Name.size();
+        
+        if((NameEnd >= Data.size()) || (Data[Offset.value()] != '<') || (Data.substr(NameBegin, Name.size()) != Name) || (std::string_view{" \t\r\n/>"}.find(Data[NameEnd]) == std::string_view::npos))
+        {
+            throw std::runtime_error{"The element index does not match the document."};
+        }
+    }
+    
+    return Offset;
+}
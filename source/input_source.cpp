@@ -0,0 +1,132 @@
+/**
+ * Copyright 2026 Hagen Möbius
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+**/
+
+#include <fcntl.h>
+#include <stdexcept>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <xml_parser/input_source.h>
+
+XML::MappedFileInputSource::MappedFileInputSource(std::filesystem::path const & Path) :
+    m_Data{nullptr},
+    m_Size{0},
+    m_Read{false}
+{
+    auto FileDescriptor = open(Path.c_str(), O_RDONLY);
+    
+    if(FileDescriptor == -1)
+    {
+        throw std::runtime_error{"Could not open the file \"" + Path.string() + "\"."};
+    }
+    
+    struct stat FileStatus;
+    
+    if(fstat(FileDescriptor, &FileStatus) == -1)
+    {
+        close(FileDescriptor);
+        
+        throw std::runtime_error{"Could not determine the size of the file \"" + Path.string() + "\"."};
+    }
+    m_Size = static_cast<std::size_t>(FileStatus.st_size);
+    if(m_Size > 0)
+    {
+        auto Data = mmap(nullptr, m_Size, PROT_READ, MAP_PRIVATE, FileDescriptor, 0);
+        
+        if(Data == MAP_FAILED)
+        {
+            close(FileDescriptor);
+            
+            throw std::runtime_error{"Could not map the file \"" + Path.string() + "\"."};
+        }
+        // the parser reads the mapping front to back exactly once
+        madvise(Data, m_Size, MADV_SEQUENTIAL);
+        m_Data = static_cast<char const *>(Data);
+    }
+    close(FileDescriptor);
+}
+
+XML::MappedFileInputSource::~MappedFileInputSource()
+{
+    if(m_Data != nullptr)
+    {
+        munmap(const_cast<char *>(m_Data), m_Size);
+    }
+}
+
+auto XML::MappedFileInputSource::GetData() const -> std::span<char const>
+{
+    return {m_Data, m_Size};
+}
+
+auto XML::MappedFileInputSource::Read() -> std::span<char const>
+{
+    if(m_Read == false)
+    {
+        m_Read = true;
+        
+        return GetData();
+    }
+    else
+    {
+        return {};
+    }
+}
+
+XML::MemoryInputSource::MemoryInputSource(std::span<char const> Data) :
+    m_Data{Data},
+    m_Read{false}
+{
+}
+
+auto XML::MemoryInputSource::GetData() const -> std::span<char const>
+{
+    return m_Data;
+}
+
+auto XML::MemoryInputSource::Read() -> std::span<char const>
+{
+    if(m_Read == false)
+    {
+        m_Read = true;
+        
+        return m_Data;
+    }
+    else
+    {
+        return {};
+    }
+}
+
+XML::StreamInputSource::StreamInputSource(std::istream & InputStream, std::size_t BlockSize) :
+    m_Block(BlockSize),
+    m_InputStream(InputStream)
+{
+}
+
+auto XML::StreamInputSource::Read() -> std::span<char const>
+{
+    m_InputStream.read(m_Block.data(), m_Block.size());
+    
+    return {m_Block.data(), static_cast<std::size_t>(m_InputStream.gcount())};
+}
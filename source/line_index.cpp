@@ -0,0 +1,74 @@
+/**
+ * Copyright 2026 Hagen Möbius
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+**/
+
+#include <algorithm>
+
+#include <xml_parser/line_index.h>
+#include <xml_parser/scanner.h>
+
+namespace
+{
+    constinit XML::Scanner const LineBreakScanner{"\n"};
+}
+
+XML::LineIndex::LineIndex() :
+    m_Size{0}
+{
+}
+
+XML::LineIndex::LineIndex(std::span<char const> Data) :
+    m_Size{0}
+{
+    Append(Data);
+}
+
+auto XML::LineIndex::Append(std::span<char const> Data) -> void
+{
+    auto const Begin = Data.data();
+    auto const End = Data.data() + Data.size();
+    
+    for(auto LineBreak = LineBreakScanner.Find(Begin, End); LineBreak != End; LineBreak = LineBreakScanner.Find(LineBreak + 1, End))
+    {
+        m_LineBreaks.push_back(m_Size + (LineBreak - Begin));
+    }
+    m_Size += Data.size();
+}
+
+auto XML::LineIndex::Clear() -> void
+{
+    m_LineBreaks.clear();
+    m_Size = 0;
+}
+
+auto XML::LineIndex::GetSize() const -> std::uint64_t
+{
+    return m_Size;
+}
+
+auto XML::LineIndex::Resolve(std::uint64_t Offset) const -> XML::Location
+{
+    // the line is the number of line breaks before the offset
+    auto const Line = static_cast<std::uint64_t>(std::ranges::lower_bound(m_LineBreaks, Offset) - m_LineBreaks.begin());
+    auto const LineBegin = (Line == 0) ? std::uint64_t{0} : m_LineBreaks[Line - 1] + 1;
+    
+    return XML::Location{Offset - LineBegin, Line, Offset};
+}
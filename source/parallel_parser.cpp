@@ -0,0 +1,150 @@
+/**
+ * Copyright 2026 Hagen Möbius
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+**/
+
+
+#include <cassert>
+#include <cstring>
+#include <functional>
+
+#include <xml_parser/parallel_parser.h>
+
+XML::Detail::EventRecorder::EventRecorder(std::span<char const> Data) :
+    m_Data{Data}
+{
+}
+
+auto XML::Detail::EventRecorder::Clear() -> void
+{
+    m_Attributes.clear();
+    m_Events.clear();
+    m_Pool.clear();
+}
+
+auto XML::Detail::EventRecorder::Comment(std::string_view Comment, XML::Location const & StartLocation) -> void
+{
+    m_Events.push_back(XML::Detail::RecordedEvent{XML::EventKind::Comment, MakeReference(Comment), StartLocation, 0, 0});
+}
+
+auto XML::Detail::EventRecorder::ElementStart(std::string_view TagName, XML::Attributes Attributes, XML::Location const & StartLocation) -> void
+{
+    auto const AttributeBegin = m_Attributes.size();
+    
+    for(auto const & Attribute : Attributes)
+    {
+        m_Attributes.emplace_back(MakeReference(Attribute.Name), MakeReference(Attribute.Value));
+    }
+    m_Events.push_back(XML::Detail::RecordedEvent{XML::EventKind::ElementStart, MakeReference(TagName), StartLocation, AttributeBegin, m_Attributes.size() - AttributeBegin});
+}
+
+auto XML::Detail::EventRecorder::ElementEnd(std::string_view TagName) -> void
+{
+    m_Events.push_back(XML::Detail::RecordedEvent{XML::EventKind::ElementEnd, MakeReference(TagName), XML::Location{0, 0, 0}, 0, 0});
+}
+
+auto XML::Detail::EventRecorder::GetAttribute(std::size_t Index) const -> std::pair<XML::Detail::StringReference, XML::Detail::StringReference> const &
+{
+    assert(Index < m_Attributes.size());
+    
+    return m_Attributes[Index];
+}
+
+auto XML::Detail::EventRecorder::GetEvents() const -> std::vector<XML::Detail::RecordedEvent> const &
+{
+    return m_Events;
+}
+
+auto XML::Detail::EventRecorder::GetString(XML::Detail::StringReference const & Reference) const -> std::string_view
+{
+    if(Reference.Pooled == true)
+    {
+        return std::string_view{m_Pool}.substr(Reference.Offset, Reference.Length);
+    }
+    else
+    {
+        return std::string_view{m_Data.data() + Reference.Offset, Reference.Length};
+    }
+}
+
+auto XML::Detail::EventRecorder::Text(std::string_view Text, XML::Location const & StartLocation) -> void
+{
+    m_Events.push_back(XML::Detail::RecordedEvent{XML::EventKind::Text, MakeReference(Text), StartLocation, 0, 0});
+}
+
+/**
+ * Most strings are views into the input, which stays valid during parsing, so only their offset is
+ * recorded. The others have been copied or decoded by the parser and are only valid during the
+ * callback.
+ **/
+auto XML::Detail::EventRecorder::MakeReference(std::string_view String) -> XML::Detail::StringReference
+{
+    auto const Less = std::less<char const *>{};
+    
+    if(String.empty() == true)
+    {
+        return XML::Detail::StringReference{0, 0, false};
+    }
+    else if((Less(String.data(), m_Data.data()) == false) && (Less(String.data(), m_Data.data() + m_Data.size()) == true))
+    {
+        return XML::Detail::StringReference{static_cast<std::size_t>(String.data() - m_Data.data()), String.size(), false};
+    }
+    else
+    {
+        auto const Offset = m_Pool.size();
+        
+        m_Pool += String;
+        
+        return XML::Detail::StringReference{Offset, String.size(), true};
+    }
+}
+
+auto XML::Detail::SplitIntoChunks(std::span<char const> Data, std::size_t ChunkSize) -> std::vector<std::size_t>
+{
+    auto Result = std::vector<std::size_t>{0};
+    auto Offset = ChunkSize;
+    
+    while(Offset < Data.size())
+    {
+        auto const LessThan = static_cast<char const *>(std::memchr(Data.data() + Offset, '<', Data.size() - Offset));
+        
+        if(LessThan == nullptr)
+        {
+            break;
+        }
+        Result.push_back(LessThan - Data.data());
+        Offset = Result.back() + ChunkSize;
+    }
+    Result.push_back(Data.size());
+    
+    return Result;
+}
+
+auto XML::Detail::Rebase(XML::Location const & Base, XML::Location const & Relative) -> XML::Location
+{
+    if(Relative.Line == 0)
+    {
+        return XML::Location{Base.Column + Relative.Column, Base.Line, Base.Offset + Relative.Offset};
+    }
+    else
+    {
+        return XML::Location{Relative.Column, Base.Line + Relative.Line, Base.Offset + Relative.Offset};
+    }
+}
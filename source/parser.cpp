@@ -20,692 +20,305 @@
  * IN THE SOFTWARE.
 **/
 
-#include <cassert>
-#include <iostream>
-#include <optional>
-
 #include <xml_parser/parser.h>
+#include <xml_parser/scanner.h>
+
+constinit XML::Scanner const XML::Detail::TextScanner{"<&\n"};
+constinit XML::Scanner const XML::Detail::CommentScanner{"-\n"};
+constinit XML::Scanner const XML::Detail::DoubleQuotedAttributeValueScanner{"\"&<>;\n"};
+constinit XML::Scanner const XML::Detail::SingleQuotedAttributeValueScanner{"'&<>;\n"};
 
-auto Forward(std::string && From, std::string & To) -> void
+XML::Parser::Handler::Handler(XML::Parser & Parser) :
+    m_Parser(Parser)
 {
-    To += From;
-    From.erase();
 }
 
-auto ForwardEntityTo(std::string & Entity, std::string & To) -> void
+auto XML::Parser::Handler::Comment(std::string_view Comment, XML::Location const & StartLocation) -> void
 {
-    if(Entity == "amp")
-    {
-        Forward("&", To);
-    }
-    else if(Entity == "gt")
-    {
-        Forward(">", To);
-    }
-    else if(Entity == "lt")
-    {
-        Forward("<", To);
-    }
-    else if(Entity == "apos")
-    {
-        Forward("'", To);
-    }
-    else if(Entity == "quot")
-    {
-        Forward("\"", To);
-    }
-    else
-    {
-        Forward("&" + Entity + ";", To);
-    }
-    Entity.erase();
+    m_Parser.CommentView(Comment, StartLocation);
 }
 
-/**
- * Parsing stages:
- * - 0  ->  document scope
- * - 1  ->  when '<' is read in the document scope
- * - 2  ->  when '<!' is read, preparing to open a comment
- * - 3  ->  when '<!-' is read, preparing to open a comment
- * - 4  ->  when '<!--' is read, comment opened
- * - 5  ->  when '<!--' .. '-' is read, preparing to close a comment
- * - 6  ->  when '<!--' .. '--' is read, comment closing, '>' expected next, which turns around to stage 0
- * - 7  ->  when '&' is read in the document scope
- * - 8  ->  when '<' was read but not continued by '!', this is an opening or self-closing tag
- * - 10 ->  when '/' is read in a tag but not after the opening '<', a self-closing tag
- * - 11 ->  when '</' is read, a closing tag
- * - 12 ->  when inside an opening or self-closing tag identifier
- * - 13 ->  when inside an attribute identifier in an opening or self-closing tag
- * - 14 ->  when inside a closing tag identifier
- * - 15 ->  when the tag identifier of an opening or self-closing tag is done
- * - 16 ->  when a whitespace is read after an attribute identifier
- * - 17 ->  when '=' is read after an attribute identifier
- * - 18 ->  when a whitespace is read after a '=' for an attribute
- * - 19 ->  when inside an attribute value with double quotes
- * - 20 ->  when '&' is read in an attribute value with double quotes
- * - 21 ->  when inside an attribute value with single quotes
- * - 22 ->  when '&' is read in an attribute value with single quotes
- **/
+auto XML::Parser::Handler::CommentFragment(std::string_view Fragment, XML::Location const & StartLocation, bool First, bool Last) -> void
+{
+    m_Parser.CommentFragmentView(Fragment, StartLocation, First, Last);
+}
+
+auto XML::Parser::Handler::ElementStart(XML::Name TagName, XML::Attributes Attributes, XML::Location const & StartLocation) -> void
+{
+    m_Parser.m_TagNameId = TagName.Id;
+    m_Parser.ElementStartView(TagName, Attributes, StartLocation);
+}
+
+auto XML::Parser::Handler::ElementEnd(XML::Name TagName) -> void
+{
+    m_Parser.m_TagNameId = TagName.Id;
+    m_Parser.ElementEndView(TagName);
+}
+
+auto XML::Parser::Handler::Text(std::string_view Text, XML::Location const & StartLocation) -> void
+{
+    m_Parser.TextView(Text, StartLocation);
+}
+
+auto XML::Parser::Handler::TextFragment(std::string_view Fragment, XML::Location const & StartLocation, bool First, bool Last) -> void
+{
+    m_Parser.TextFragmentView(Fragment, StartLocation, First, Last);
+}
+
+XML::Parser::Parser() :
+    m_Handler{*this},
+    m_Parser{m_Handler},
+    m_TagNameId{XML::NoSymbol},
+    m_Replaying{false},
+    m_ReplaySkipping{false},
+    m_ReplaySuspended{false},
+    m_SymbolTable{nullptr}
+{
+}
 
 XML::Parser::Parser(std::istream & InputStream) :
-    m_InputStream(InputStream)
+    m_Handler{*this},
+    m_Parser{m_Handler, InputStream},
+    m_TagNameId{XML::NoSymbol},
+    m_Replaying{false},
+    m_ReplaySkipping{false},
+    m_ReplaySuspended{false},
+    m_SymbolTable{nullptr}
 {
 }
 
+XML::Parser::Parser(std::span<char const> Data) :
+    m_Handler{*this},
+    m_Parser{m_Handler, Data},
+    m_TagNameId{XML::NoSymbol},
+    m_Replaying{false},
+    m_ReplaySkipping{false},
+    m_ReplaySuspended{false},
+    m_SymbolTable{nullptr}
+{
+}
+
+XML::Parser::Parser(std::filesystem::path const & Path) :
+    m_Handler{*this},
+    m_Parser{m_Handler, Path},
+    m_TagNameId{XML::NoSymbol},
+    m_Replaying{false},
+    m_ReplaySkipping{false},
+    m_ReplaySuspended{false},
+    m_SymbolTable{nullptr}
+{
+}
+
+XML::Parser::Parser(std::unique_ptr<XML::InputSource> InputSource) :
+    m_Handler{*this},
+    m_Parser{m_Handler, std::move(InputSource)},
+    m_TagNameId{XML::NoSymbol},
+    m_Replaying{false},
+    m_ReplaySkipping{false},
+    m_ReplaySuspended{false},
+    m_SymbolTable{nullptr}
+{
+}
+
+auto XML::Parser::Feed(std::span<char const> Chunk) -> void
+{
+    m_Parser.Feed(Chunk);
+}
+
+auto XML::Parser::Finish() -> void
+{
+    m_Parser.Finish();
+}
+
 auto XML::Parser::Parse() -> void
 {
-    auto Attributes = std::map<std::string, std::string>{};
-    auto AttributeName = std::string{};
-    auto AttributeValue = std::string{};
-    auto Comment = std::string{};
-    auto TagName = std::string{};
-    auto Text = std::string{};
-    auto Entity = std::string{};
-    auto Character = '\0';
-    auto ParsingStage = 0u;
-    auto CurrentLocation = XML::Location{};
+    m_Parser.Parse();
+}
+
+auto XML::Parser::Replay(XML::EventCache const & Cache) -> void
+{
+    auto NameIds = std::vector<XML::SymbolId>(Cache.GetNameCount(), XML::NoSymbol);
     
-    CurrentLocation.Column = 0;
-    CurrentLocation.Line = 0;
+    if(m_SymbolTable != nullptr)
+    {
+        for(auto Index = std::size_t{0}; Index < NameIds.size(); ++Index)
+        {
+            NameIds[Index] = m_SymbolTable->Intern(Cache.GetName(Index));
+        }
+    }
     
-    auto StartLocation = std::optional<XML::Location>{};
+    auto Event = XML::Detail::CachedEvent{};
+    auto Position = std::size_t{0};
     
-    while(m_InputStream.get(Character))
+    m_Replaying = true;
+    m_ReplaySkipping = false;
+    m_ReplaySuspended = false;
+    // a corrupt cache or a handler may throw, after which the parser has to work as before
+    try
     {
-        //~ std::cout << std::boolalpha << "In stage " << ParsingStage << " got '"  << Character << "'. (Comment=\"" << Comment << "\"; TagName=\"" << TagName << "\"; Text=\"" << Text << "\"; AttributeName=\"" << AttributeName << "\"; AttributeValue=\"" << AttributeValue << "\"; Entity=\"" << Entity << "\"; CurrentLocation.Line=\"" << CurrentLocation.Line << "\"; CurrentLocation.Column=\"" << CurrentLocation.Column << "\"; ";
-        //~ if(StartLocation.has_value() == true)
-        //~ {
-            //~ std::cout << "StartLocation.Line=\"" << StartLocation->Line << "\"; StartLocation.Column=\"" << StartLocation->Column << "\"";
-        //~ }
-        //~ else
-        //~ {
-            //~ std::cout << "StartLocation=none";
-        //~ }
-        //~ std::cout << ')' << std::endl;
-        switch(Character)
+        while((m_ReplaySuspended == false) && (Cache.Next(Position, Event) == true))
         {
-        case '\n':
-        case '\t':
-        case ' ':
-            {
-                if(ParsingStage == 0)
-                {
-                    if(StartLocation.has_value() == false)
-                    {
-                        StartLocation = CurrentLocation;
-                    }
-                    Text += Character;
-                }
-                else if(ParsingStage == 4)
-                {
-                    Comment += Character;
-                }
-                else if(ParsingStage == 5)
-                {
-                    Comment += '-';
-                    Comment += Character;
-                    ParsingStage = 4;
-                }
-                else if(ParsingStage == 6)
-                {
-                    Comment += "--";
-                    Comment += Character;
-                    ParsingStage = 4;
-                }
-                else if(ParsingStage == 12)
-                {
-                    ParsingStage = 15;
-                }
-                else if(ParsingStage == 13)
-                {
-                    ParsingStage = 16;
-                }
-                else if(ParsingStage == 17)
-                {
-                    ParsingStage = 18;
-                }
-                else if(ParsingStage == 19)
-                {
-                    AttributeValue += Character;
-                }
-                else if(ParsingStage == 21)
-                {
-                    AttributeValue += Character;
-                }
-                
-                break;
-            }
-        case '=':
-            {
-                if(ParsingStage == 0)
-                {
-                    if(StartLocation.has_value() == false)
-                    {
-                        StartLocation = CurrentLocation;
-                    }
-                    Text += Character;
-                }
-                else if(ParsingStage == 4)
-                {
-                    Comment += Character;
-                }
-                else if(ParsingStage == 5)
-                {
-                    Comment += '-';
-                    Comment += Character;
-                    ParsingStage = 4;
-                }
-                else if(ParsingStage == 13)
-                {
-                    ParsingStage = 17;
-                }
-                else if(ParsingStage == 16)
-                {
-                    ParsingStage = 17;
-                }
-                else if(ParsingStage == 19)
-                {
-                    AttributeValue += Character;
-                }
-                else if(ParsingStage == 21)
-                {
-                    AttributeValue += Character;
-                }
-                
-                break;
-            }
-        case '"':
-            {
-                if(ParsingStage == 0)
-                {
-                    if(StartLocation.has_value() == false)
-                    {
-                        StartLocation = CurrentLocation;
-                    }
-                    Text += Character;
-                }
-                else if(ParsingStage == 4)
-                {
-                    Comment += Character;
-                }
-                else if(ParsingStage == 5)
-                {
-                    Comment += '-';
-                    Comment += Character;
-                    ParsingStage = 4;
-                }
-                else if(ParsingStage == 17)
-                {
-                    ParsingStage = 19;
-                }
-                else if(ParsingStage == 18)
-                {
-                    ParsingStage = 19;
-                }
-                else if(ParsingStage == 19)
-                {
-                    Attributes[AttributeName] = AttributeValue;
-                    AttributeName.erase();
-                    AttributeValue.erase();
-                    ParsingStage = 8;
-                }
-                else if(ParsingStage == 21)
-                {
-                    AttributeValue += Character;
-                }
-                
-                break;
-            }
-        case '\'':
-            {
-                if(ParsingStage == 0)
-                {
-                    if(StartLocation.has_value() == false)
-                    {
-                        StartLocation = CurrentLocation;
-                    }
-                    Text += Character;
-                }
-                else if(ParsingStage == 4)
-                {
-                    Comment += Character;
-                }
-                else if(ParsingStage == 5)
-                {
-                    Comment += '-';
-                    Comment += Character;
-                    ParsingStage = 4;
-                }
-                else if(ParsingStage == 17)
-                {
-                    ParsingStage = 21;
-                }
-                else if(ParsingStage == 18)
-                {
-                    ParsingStage = 21;
-                }
-                else if(ParsingStage == 19)
-                {
-                    AttributeValue += Character;
-                }
-                else if(ParsingStage == 21)
-                {
-                    Attributes[AttributeName] = AttributeValue;
-                    AttributeName.erase();
-                    AttributeValue.erase();
-                    ParsingStage = 8;
-                }
-                
-                break;
-            }
-        case '<':
-            {
-                if(ParsingStage == 0)
-                {
-                    if(Text.empty() == false)
-                    {
-                        assert(StartLocation.has_value() == true);
-                        this->Text(Text, StartLocation.value());
-                        Text.erase();
-                    }
-                    StartLocation = CurrentLocation;
-                    ParsingStage = 1;
-                }
-                else if(ParsingStage == 4)
-                {
-                    Comment += Character;
-                }
-                else if(ParsingStage == 5)
-                {
-                    Comment += '-';
-                    Comment += Character;
-                    ParsingStage = 4;
-                }
-                
-                break;
-            }
-        case '>':
-            {
-                if(ParsingStage == 0)
-                {
-                    if(StartLocation.has_value() == false)
-                    {
-                        StartLocation = CurrentLocation;
-                    }
-                    Text += Character;
-                }
-                else if(ParsingStage == 4)
-                {
-                    Comment += Character;
-                }
-                else if(ParsingStage == 5)
-                {
-                    Comment += '-';
-                    Comment += Character;
-                    ParsingStage = 4;
-                }
-                else if(ParsingStage == 6)
-                {
-                    assert(StartLocation.has_value() == true);
-                    this->Comment(Comment, StartLocation.value());
-                    Comment.erase();
-                    StartLocation.reset();
-                    ParsingStage = 0;
-                }
-                else if(ParsingStage == 8)
-                {
-                    assert(StartLocation.has_value() == true);
-                    ElementStart(TagName, Attributes, StartLocation.value());
-                    TagName.erase();
-                    Attributes.clear();
-                    StartLocation.reset();
-                    ParsingStage = 0;
-                }
-                else if(ParsingStage == 10)
-                {
-                    assert(StartLocation.has_value() == true);
-                    ElementStart(TagName, Attributes, StartLocation.value());
-                    ElementEnd(TagName);
-                    TagName.erase();
-                    Attributes.clear();
-                    StartLocation.reset();
-                    ParsingStage = 0;
-                }
-                else if(ParsingStage == 11)
-                {
-                    ElementEnd(TagName);
-                    TagName.erase();
-                    ParsingStage = 0;
-                }
-                else if(ParsingStage == 12)
-                {
-                    assert(StartLocation.has_value() == true);
-                    ElementStart(TagName, Attributes, StartLocation.value());
-                    TagName.erase();
-                    Attributes.clear();
-                    StartLocation.reset();
-                    ParsingStage = 0;
-                }
-                else if(ParsingStage == 14)
-                {
-                    ElementEnd(TagName);
-                    TagName.erase();
-                    ParsingStage = 0;
-                }
-                
-                break;
-            }
-        case '/':
-            {
-                if(ParsingStage == 0)
-                {
-                    if(StartLocation.has_value() == false)
-                    {
-                        StartLocation = CurrentLocation;
-                    }
-                    Text += Character;
-                }
-                else if(ParsingStage == 1)
-                {
-                    StartLocation.reset();
-                    ParsingStage = 11;
-                }
-                else if(ParsingStage == 4)
-                {
-                    Comment += Character;
-                }
-                else if(ParsingStage == 5)
-                {
-                    Comment += '-';
-                    Comment += Character;
-                    ParsingStage = 4;
-                }
-                else if(ParsingStage == 8)
-                {
-                    ParsingStage = 10;
-                }
-                else if(ParsingStage == 12)
-                {
-                    ParsingStage = 10;
-                }
-                else if(ParsingStage == 15)
-                {
-                    ParsingStage = 10;
-                }
-                else if(ParsingStage == 19)
-                {
-                    AttributeValue += Character;
-                }
-                else if(ParsingStage == 21)
-                {
-                    AttributeValue += Character;
-                }
-                
-                break;
-            }
-        case '&':
+            switch(Event.Kind)
             {
-                if(ParsingStage == 0)
-                {
-                    if(StartLocation.has_value() == false)
-                    {
-                        StartLocation = CurrentLocation;
-                    }
-                    ParsingStage = 7;
-                }
-                else if(ParsingStage == 4)
-                {
-                    Comment += Character;
-                }
-                else if(ParsingStage == 5)
+            case XML::EventKind::Comment:
                 {
-                    Comment += '-';
-                    Comment += Character;
-                    ParsingStage = 4;
+                    CommentView(Event.Text, Event.Location);
+                    
+                    break;
                 }
-                else if(ParsingStage == 19)
+            case XML::EventKind::ElementEnd:
                 {
-                    ParsingStage = 20;
+                    m_TagNameId = NameIds[Event.NameIndex];
+                    ElementEndView(Cache.GetName(Event.NameIndex));
+                    
+                    break;
                 }
-                else if(ParsingStage == 21)
+            case XML::EventKind::ElementStart:
                 {
-                    ParsingStage = 22;
-                }
-                
-                break;
-            }
-        case ';':
-            {
-                if(ParsingStage == 0)
-                {
-                    if(StartLocation.has_value() == false)
+                    for(auto & Attribute : Event.Attributes)
                     {
-                        StartLocation = CurrentLocation;
+                        Attribute.NameId = NameIds[Attribute.NameId];
                     }
-                    Text += Character;
-                }
-                else if(ParsingStage == 4)
-                {
-                    Comment += Character;
-                }
-                else if(ParsingStage == 5)
-                {
-                    Comment += '-';
-                    Comment += Character;
-                    ParsingStage = 4;
-                }
-                else if(ParsingStage == 7)
-                {
-                    ForwardEntityTo(Entity, Text);
-                    ParsingStage = 0;
-                }
-                else if(ParsingStage == 20)
-                {
-                    ForwardEntityTo(Entity, AttributeValue);
-                    ParsingStage = 19;
-                }
-                else if(ParsingStage == 22)
-                {
-                    ForwardEntityTo(Entity, AttributeValue);
-                    ParsingStage = 21;
-                }
-                
-                break;
-            }
-        case '!':
-            {
-                if(ParsingStage == 0)
-                {
-                    if(StartLocation.has_value() == false)
+                    m_TagNameId = NameIds[Event.NameIndex];
+                    ElementStartView(Cache.GetName(Event.NameIndex), XML::Attributes{Event.Attributes}, Event.Location);
+                    if(m_ReplaySkipping == true)
                     {
-                        StartLocation = CurrentLocation;
+                        Cache.SkipElement(Position, Event);
+                        m_ReplaySkipping = false;
                     }
-                    Text += Character;
+                    
+                    break;
                 }
-                else if(ParsingStage == 1)
+            case XML::EventKind::End:
                 {
-                    ParsingStage = 2;
+                    break;
                 }
-                else if(ParsingStage == 4)
+            case XML::EventKind::Text:
                 {
-                    Comment += Character;
+                    TextView(Event.Text, Event.Location);
+                    
+                    break;
                 }
-                else if(ParsingStage == 5)
-                {
-                    Comment += '-';
-                    Comment += Character;
-                    ParsingStage = 4;
-                }
-                else if(ParsingStage == 19)
-                {
-                    AttributeValue += Character;
-                }
-                else if(ParsingStage == 21)
-                {
-                    AttributeValue += Character;
-                }
-                
-                break;
-            }
-        case '-':
-            {
-                if(ParsingStage == 0)
-                {
-                    if(StartLocation.has_value() == false)
-                    {
-                        StartLocation = CurrentLocation;
-                    }
-                    Text += Character;
-                }
-                else if(ParsingStage == 2)
-                {
-                    ParsingStage = 3;
-                }
-                else if(ParsingStage == 3)
-                {
-                    ParsingStage = 4;
-                }
-                else if(ParsingStage == 4)
-                {
-                    ParsingStage = 5;
-                }
-                else if(ParsingStage == 5)
-                {
-                    ParsingStage = 6;
-                }
-                else if(ParsingStage == 6)
-                {
-                    Comment += '-';
-                }
-                else if(ParsingStage == 12)
-                {
-                    TagName += Character;
-                }
-                else if(ParsingStage == 13)
-                {
-                    AttributeName += Character;
-                }
-                else if(ParsingStage == 14)
-                {
-                    TagName += Character;
-                }
-                else if(ParsingStage == 19)
-                {
-                    AttributeValue += Character;
-                }
-                else if(ParsingStage == 21)
-                {
-                    AttributeValue += Character;
-                }
-                
-                break;
             }
-        default:
-            {
-                if(ParsingStage == 0)
-                {
-                    if(StartLocation.has_value() == false)
-                    {
-                        StartLocation = CurrentLocation;
-                    }
-                    Text += Character;
-                }
-                else if(ParsingStage == 1)
-                {
-                    TagName += Character;
-                    ParsingStage = 12;
-                }
-                else if(ParsingStage == 4)
-                {
-                    Comment += Character;
-                }
-                else if(ParsingStage == 5)
-                {
-                    Comment += '-';
-                    Comment += Character;
-                    ParsingStage = 4;
-                }
-                else if(ParsingStage == 6)
-                {
-                    Comment += "--";
-                    Comment += Character;
-                    ParsingStage = 4;
-                }
-                else if(ParsingStage == 7)
-                {
-                    Entity += Character;
-                }
-                else if(ParsingStage == 8)
-                {
-                    AttributeName += Character;
-                    ParsingStage = 13;
-                }
-                else if(ParsingStage == 11)
-                {
-                    TagName += Character;
-                    ParsingStage = 14;
-                }
-                else if(ParsingStage == 12)
-                {
-                    TagName += Character;
-                }
-                else if(ParsingStage == 13)
-                {
-                    AttributeName += Character;
-                }
-                else if(ParsingStage == 14)
-                {
-                    TagName += Character;
-                }
-                else if(ParsingStage == 15)
-                {
-                    AttributeName += Character;
-                    ParsingStage = 13;
-                }
-                else if(ParsingStage == 19)
-                {
-                    AttributeValue += Character;
-                }
-                else if(ParsingStage == 20)
-                {
-                    Entity += Character;
-                }
-                else if(ParsingStage == 21)
-                {
-                    AttributeValue += Character;
-                }
-                else if(ParsingStage == 22)
-                {
-                    Entity += Character;
-                }
-                
-                break;
-            }
-        }
-        if(Character == '\n')
-        {
-            CurrentLocation.Column = 0;
-            CurrentLocation.Line += 1;
-        }
-        else
-        {
-            CurrentLocation.Column += 1;
         }
     }
+    catch(...)
+    {
+        m_Replaying = false;
+        
+        throw;
+    }
+    m_Replaying = false;
+}
+
+auto XML::Parser::SetDecodeEntities(bool DecodeEntities) -> void
+{
+    m_Parser.SetDecodeEntities(DecodeEntities);
+}
+
+auto XML::Parser::SetElementIndex(XML::ElementIndex * ElementIndex) -> void
+{
+    m_Parser.SetElementIndex(ElementIndex);
+}
+
+auto XML::Parser::SetFragmentSize(std::size_t FragmentSize) -> void
+{
+    m_Parser.SetFragmentSize(FragmentSize);
+}
+
+auto XML::Parser::SetLineIndex(XML::LineIndex * LineIndex) -> void
+{
+    m_Parser.SetLineIndex(LineIndex);
+}
+
+auto XML::Parser::SetLocationTracking(XML::LocationTracking LocationTracking) -> void
+{
+    m_Parser.SetLocationTracking(LocationTracking);
+}
+
+auto XML::Parser::SetStatistics(XML::Statistics * Statistics) -> void
+{
+    m_Parser.SetStatistics(Statistics);
+}
+
+auto XML::Parser::SetSymbolTable(XML::SymbolTable * SymbolTable) -> void
+{
+    m_Parser.SetSymbolTable(SymbolTable);
+    m_SymbolTable = SymbolTable;
 }
 
 auto XML::Parser::Comment(std::string const &, XML::Location const &) -> void
 {
 }
 
+auto XML::Parser::CommentFragmentView(std::string_view, XML::Location const &, bool, bool) -> void
+{
+}
+
+auto XML::Parser::CommentView(std::string_view Comment, XML::Location const & StartLocation) -> void
+{
+    m_Content.assign(Comment);
+    this->Comment(m_Content, StartLocation);
+}
+
 auto XML::Parser::ElementStart(std::string const &, std::map<std::string, std::string> const &, XML::Location const &) -> void
 {
 }
 
+auto XML::Parser::ElementStartView(std::string_view TagName, XML::Attributes Attributes, XML::Location const & StartLocation) -> void
+{
+    m_TagName.assign(TagName);
+    m_Attributes.clear();
+    for(auto & Attribute : Attributes)
+    {
+        m_Attributes[std::string{Attribute.Name}] = Attribute.Value;
+    }
+    ElementStart(m_TagName, m_Attributes, StartLocation);
+}
+
 auto XML::Parser::ElementEnd(std::string const &) -> void
 {
 }
 
+auto XML::Parser::ElementEndView(std::string_view TagName) -> void
+{
+    m_TagName.assign(TagName);
+    ElementEnd(m_TagName);
+}
+
+auto XML::Parser::GetTagNameId() const -> XML::SymbolId
+{
+    return m_TagNameId;
+}
+
+auto XML::Parser::SkipElement() -> void
+{
+    if(m_Replaying == true)
+    {
+        m_ReplaySkipping = true;
+    }
+    else
+    {
+        m_Parser.SkipElement();
+    }
+}
+
+auto XML::Parser::Suspend() -> void
+{
+    m_Parser.Suspend();
+    m_ReplaySuspended = true;
+}
+
 auto XML::Parser::Text(std::string const &, XML::Location const &) -> void
 {
 }
+
+auto XML::Parser::TextFragmentView(std::string_view, XML::Location const &, bool, bool) -> void
+{
+}
+
+auto XML::Parser::TextView(std::string_view Text, XML::Location const & StartLocation) -> void
+{
+    m_Content.assign(Text);
+    this->Text(m_Content, StartLocation);
+}
@@ -0,0 +1,340 @@
+/**
+ * Copyright 2026 Hagen Möbius
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+**/
+
+#include <algorithm>
+#include <stdexcept>
+
+#include <xml_parser/path_dispatcher.h>
+
+namespace
+{
+    auto IsNameCharacter(char Character) -> bool
+    {
+        return (Character != '/') && (Character != '*') && (Character != '[') && (Character != ']') && (Character != '@') && (Character != '=') && (Character != '"') && (Character != '\'') && (Character != ' ') && (Character != '\t') && (Character != '\n') && (Character != '\r');
+    }
+    
+    auto ReadName(std::string_view & Pattern) -> std::string_view
+    {
+        auto Length = std::size_t{0};
+        
+        while((Length < Pattern.size()) && (IsNameCharacter(Pattern[Length]) == true))
+        {
+            ++Length;
+        }
+        
+        auto const Result = Pattern.substr(0, Length);
+        
+        Pattern.remove_prefix(Length);
+        
+        return Result;
+    }
+    
+    auto MakePatternError(std::string_view Pattern, std::string_view Problem) -> std::invalid_argument
+    {
+        return std::invalid_argument{"The path pattern \"" + std::string{Pattern} + "\" " + std::string{Problem} + "."};
+    }
+}
+
+XML::PathDispatcher::PathDispatcher()
+{
+    Initialize();
+}
+
+XML::PathDispatcher::PathDispatcher(std::istream & InputStream) :
+    XML::Parser{InputStream}
+{
+    Initialize();
+}
+
+XML::PathDispatcher::PathDispatcher(std::span<char const> Data) :
+    XML::Parser{Data}
+{
+    Initialize();
+}
+
+XML::PathDispatcher::PathDispatcher(std::filesystem::path const & Path) :
+    XML::Parser{Path}
+{
+    Initialize();
+}
+
+XML::PathDispatcher::PathDispatcher(std::unique_ptr<XML::InputSource> InputSource) :
+    XML::Parser{std::move(InputSource)}
+{
+    Initialize();
+}
+
+auto XML::PathDispatcher::Subscribe(std::string_view Pattern, XML::PathSubscription Subscription) -> void
+{
+    auto const FullPattern = Pattern;
+    auto Current = std::size_t{0};
+    
+    if(Pattern.empty() == true)
+    {
+        throw MakePatternError(FullPattern, "is empty");
+    }
+    while(Pattern.empty() == false)
+    {
+        auto Step = XML::PathDispatcher::Edge{};
+        
+        if(Pattern.starts_with("//") == true)
+        {
+            Step.Descendant = true;
+            Pattern.remove_prefix(2);
+        }
+        else if(Pattern.starts_with('/') == true)
+        {
+            Step.Descendant = false;
+            Pattern.remove_prefix(1);
+        }
+        else
+        {
+            throw MakePatternError(FullPattern, "has a step that does not start with '/'");
+        }
+        if(Pattern.starts_with('*') == true)
+        {
+            Step.NameId = XML::NoSymbol;
+            Pattern.remove_prefix(1);
+        }
+        else
+        {
+            auto const Name = ReadName(Pattern);
+            
+            if(Name.empty() == true)
+            {
+                throw MakePatternError(FullPattern, "has a step without a name");
+            }
+            Step.NameId = m_SymbolTable.Intern(Name);
+        }
+        if(Pattern.starts_with("[@") == true)
+        {
+            Pattern.remove_prefix(2);
+            
+            auto const AttributeName = ReadName(Pattern);
+            
+            if(AttributeName.empty() == true)
+            {
+                throw MakePatternError(FullPattern, "has a predicate without an attribute name");
+            }
+            Step.AttributeName = AttributeName;
+            if(Pattern.starts_with('=') == true)
+            {
+                Pattern.remove_prefix(1);
+                if((Pattern.starts_with('"') == false) && (Pattern.starts_with('\'') == false))
+                {
+                    throw MakePatternError(FullPattern, "has a predicate with an unquoted value");
+                }
+                
+                auto const ValueEnd = Pattern.find(Pattern[0], 1);
+                
+                if(ValueEnd == std::string_view::npos)
+                {
+                    throw MakePatternError(FullPattern, "has a predicate with an unterminated value");
+                }
+                Step.AttributeValue = Pattern.substr(1, ValueEnd - 1);
+                Pattern.remove_prefix(ValueEnd + 1);
+            }
+            if(Pattern.starts_with(']') == false)
+            {
+                throw MakePatternError(FullPattern, "has an unterminated predicate");
+            }
+            Pattern.remove_prefix(1);
+        }
+        
+        // patterns with a common prefix share their states
+        auto const & Edges = m_States[Current].Edges;
+        auto const SharedEdge = std::ranges::find_if(Edges, [&Step](auto const & Edge) { return (Edge.NameId == Step.NameId) && (Edge.Descendant == Step.Descendant) && (Edge.AttributeName == Step.AttributeName) && (Edge.AttributeValue == Step.AttributeValue); });
+        
+        if(SharedEdge != Edges.end())
+        {
+            Current = SharedEdge->Target;
+        }
+        else
+        {
+            Step.Target = m_States.size();
+            m_States.emplace_back();
+            
+            auto & State = m_States[Current];
+            
+            State.Edges.insert(std::ranges::upper_bound(State.Edges, Step.NameId, {}, &XML::PathDispatcher::Edge::NameId), Step);
+            if(Step.Descendant == true)
+            {
+                State.HasDescendantEdges = true;
+            }
+            Current = Step.Target;
+        }
+    }
+    m_States[Current].Subscriptions.push_back(m_Subscriptions.size());
+    m_Subscriptions.push_back(std::move(Subscription));
+}
+
+auto XML::PathDispatcher::CommentView(std::string_view, XML::Location const &) -> void
+{
+}
+
+auto XML::PathDispatcher::ElementStartView(std::string_view TagName, XML::Attributes Attributes, XML::Location const & StartLocation) -> void
+{
+    auto const NameId = m_SymbolTable.Find(TagName).value_or(XML::NoSymbol);
+    auto const ParentBegin = m_Levels.back();
+    auto const ParentEnd = m_ActiveStates.size();
+    
+    m_Levels.push_back(ParentEnd);
+    for(auto Index = ParentBegin; Index < ParentEnd; ++Index)
+    {
+        auto const Active = m_ActiveStates[Index];
+        auto const & Edges = m_States[Active.State].Edges;
+        
+        // the edges for the element's name and those for any element
+        for(auto EdgeNameId : {NameId, XML::NoSymbol})
+        {
+            for(auto const & Edge : std::ranges::equal_range(Edges, EdgeNameId, {}, &XML::PathDispatcher::Edge::NameId))
+            {
+                if(((Active.Carried == false) || (Edge.Descendant == true)) && (MatchesPredicate(Edge, Attributes) == true))
+                {
+                    Enter(Edge.Target, false);
+                }
+            }
+            if(NameId == XML::NoSymbol)
+            {
+                break;
+            }
+        }
+        if(m_States[Active.State].HasDescendantEdges == true)
+        {
+            Enter(Active.State, true);
+        }
+    }
+    
+    // the content is only needed if a pattern can still match inside or a subscription wants the texts
+    auto NeedsContent = false;
+    
+    for(auto Index = m_Levels.back(); Index < m_ActiveStates.size(); ++Index)
+    {
+        auto const & Active = m_ActiveStates[Index];
+        auto const & State = m_States[Active.State];
+        
+        if(State.Edges.empty() == false)
+        {
+            NeedsContent = true;
+        }
+        if(Active.Carried == false)
+        {
+            for(auto SubscriptionIndex : State.Subscriptions)
+            {
+                auto const & Subscription = m_Subscriptions[SubscriptionIndex];
+                
+                if(Subscription.Text)
+                {
+                    NeedsContent = true;
+                }
+                if(Subscription.ElementStart)
+                {
+                    Subscription.ElementStart(TagName, Attributes, StartLocation);
+                }
+            }
+        }
+    }
+    if(NeedsContent == false)
+    {
+        SkipElement();
+    }
+}
+
+auto XML::PathDispatcher::ElementEndView(std::string_view TagName) -> void
+{
+    // the document level itself is never closed, not even by a stray end tag
+    if(m_Levels.size() == 1)
+    {
+        return;
+    }
+    for(auto Index = m_Levels.back(); Index < m_ActiveStates.size(); ++Index)
+    {
+        if(m_ActiveStates[Index].Carried == false)
+        {
+            for(auto SubscriptionIndex : m_States[m_ActiveStates[Index].State].Subscriptions)
+            {
+                auto const & Subscription = m_Subscriptions[SubscriptionIndex];
+                
+                if(Subscription.ElementEnd)
+                {
+                    Subscription.ElementEnd(TagName);
+                }
+            }
+        }
+    }
+    m_ActiveStates.resize(m_Levels.back());
+    m_Levels.pop_back();
+}
+
+auto XML::PathDispatcher::Enter(std::size_t State, bool Carried) -> void
+{
+    auto const Existing = std::find_if(m_ActiveStates.begin() + m_Levels.back(), m_ActiveStates.end(), [State](auto const & Active) { return Active.State == State; });
+    
+    if(Existing == m_ActiveStates.end())
+    {
+        m_ActiveStates.push_back(XML::PathDispatcher::ActiveState{Carried, State});
+    }
+    else if(Carried == false)
+    {
+        // a state that an element matches also follows the element's child edges
+        Existing->Carried = false;
+    }
+}
+
+auto XML::PathDispatcher::Initialize() -> void
+{
+    // the first state belongs to the document, which is the parent of the root element
+    m_ActiveStates.push_back(XML::PathDispatcher::ActiveState{false, 0});
+    m_Levels.push_back(0);
+    m_States.emplace_back();
+}
+
+auto XML::PathDispatcher::MatchesPredicate(XML::PathDispatcher::Edge const & Edge, XML::Attributes Attributes) -> bool
+{
+    if(Edge.AttributeName.has_value() == false)
+    {
+        return true;
+    }
+    
+    auto const Value = Attributes.Find(Edge.AttributeName.value());
+    
+    return (Value.has_value() == true) && ((Edge.AttributeValue.has_value() == false) || (Value.value() == Edge.AttributeValue.value()));
+}
+
+auto XML::PathDispatcher::TextView(std::string_view Text, XML::Location const & StartLocation) -> void
+{
+    for(auto Index = m_Levels.back(); Index < m_ActiveStates.size(); ++Index)
+    {
+        if(m_ActiveStates[Index].Carried == false)
+        {
+            for(auto SubscriptionIndex : m_States[m_ActiveStates[Index].State].Subscriptions)
+            {
+                auto const & Subscription = m_Subscriptions[SubscriptionIndex];
+                
+                if(Subscription.Text)
+                {
+                    Subscription.Text(Text, StartLocation);
+                }
+            }
+        }
+    }
+}
@@ -0,0 +1,192 @@
+/**
+ * Copyright 2026 Hagen Möbius
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+**/
+
+
+#include <xml_parser/reader.h>
+
+XML::Reader::Reader(std::istream & InputStream) :
+    m_EventKind{XML::EventKind::End},
+    m_Location{0, 0, 0},
+    m_NameId{XML::NoSymbol},
+    m_Parser{*this, InputStream},
+    m_PendingElementEnd{false}
+{
+}
+
+XML::Reader::Reader(std::span<char const> Data) :
+    m_EventKind{XML::EventKind::End},
+    m_Location{0, 0, 0},
+    m_NameId{XML::NoSymbol},
+    m_Parser{*this, Data},
+    m_PendingElementEnd{false}
+{
+}
+
+XML::Reader::Reader(std::filesystem::path const & Path) :
+    m_EventKind{XML::EventKind::End},
+    m_Location{0, 0, 0},
+    m_NameId{XML::NoSymbol},
+    m_Parser{*this, Path},
+    m_PendingElementEnd{false}
+{
+}
+
+XML::Reader::Reader(std::unique_ptr<XML::InputSource> InputSource) :
+    m_EventKind{XML::EventKind::End},
+    m_Location{0, 0, 0},
+    m_NameId{XML::NoSymbol},
+    m_Parser{*this, std::move(InputSource)},
+    m_PendingElementEnd{false}
+{
+}
+
+auto XML::Reader::GetAttributes() const -> XML::Attributes
+{
+    return m_Attributes;
+}
+
+auto XML::Reader::GetEventKind() const -> XML::EventKind
+{
+    return m_EventKind;
+}
+
+auto XML::Reader::GetLocation() const -> XML::Location const &
+{
+    return m_Location;
+}
+
+auto XML::Reader::GetName() const -> std::string_view
+{
+    return m_Name;
+}
+
+auto XML::Reader::GetNameId() const -> XML::SymbolId
+{
+    return m_NameId;
+}
+
+auto XML::Reader::GetText() const -> std::string_view
+{
+    return m_Text;
+}
+
+auto XML::Reader::Next() -> XML::EventKind
+{
+    if(m_PendingElementEnd == true)
+    {
+        // the end of a self-closing element was reported together with its start
+        m_PendingElementEnd = false;
+        m_EventKind = XML::EventKind::ElementEnd;
+        m_Attributes = {};
+    }
+    else
+    {
+        m_EventKind = XML::EventKind::End;
+        m_Attributes = {};
+        m_Name = {};
+        m_NameId = XML::NoSymbol;
+        m_Text = {};
+        m_Parser.Parse();
+    }
+    
+    return m_EventKind;
+}
+
+auto XML::Reader::SetDecodeEntities(bool DecodeEntities) -> void
+{
+    m_Parser.SetDecodeEntities(DecodeEntities);
+}
+
+auto XML::Reader::SetElementIndex(XML::ElementIndex * ElementIndex) -> void
+{
+    m_Parser.SetElementIndex(ElementIndex);
+}
+
+auto XML::Reader::SetLineIndex(XML::LineIndex * LineIndex) -> void
+{
+    m_Parser.SetLineIndex(LineIndex);
+}
+
+auto XML::Reader::SetLocationTracking(XML::LocationTracking LocationTracking) -> void
+{
+    m_Parser.SetLocationTracking(LocationTracking);
+}
+
+auto XML::Reader::SetStatistics(XML::Statistics * Statistics) -> void
+{
+    m_Parser.SetStatistics(Statistics);
+}
+
+auto XML::Reader::SetSymbolTable(XML::SymbolTable * SymbolTable) -> void
+{
+    m_Parser.SetSymbolTable(SymbolTable);
+}
+
+auto XML::Reader::SkipElement() -> void
+{
+    // a self-closing element has no content to skip
+    if((m_EventKind == XML::EventKind::ElementStart) && (m_PendingElementEnd == false))
+    {
+        m_Parser.SkipElement();
+    }
+}
+
+auto XML::Reader::Comment(std::string_view Comment, XML::Location const & StartLocation) -> void
+{
+    m_EventKind = XML::EventKind::Comment;
+    m_Location = StartLocation;
+    m_Text = Comment;
+    m_Parser.Suspend();
+}
+
+auto XML::Reader::ElementStart(XML::Name TagName, XML::Attributes Attributes, XML::Location const & StartLocation) -> void
+{
+    m_Attributes = Attributes;
+    m_EventKind = XML::EventKind::ElementStart;
+    m_Location = StartLocation;
+    m_Name = TagName;
+    m_NameId = TagName.Id;
+    m_Parser.Suspend();
+}
+
+auto XML::Reader::ElementEnd(XML::Name TagName) -> void
+{
+    if(m_EventKind == XML::EventKind::ElementStart)
+    {
+        m_PendingElementEnd = true;
+    }
+    else
+    {
+        m_EventKind = XML::EventKind::ElementEnd;
+        m_Name = TagName;
+        m_NameId = TagName.Id;
+        m_Parser.Suspend();
+    }
+}
+
+auto XML::Reader::Text(std::string_view Text, XML::Location const & StartLocation) -> void
+{
+    m_EventKind = XML::EventKind::Text;
+    m_Location = StartLocation;
+    m_Text = Text;
+    m_Parser.Suspend();
+}
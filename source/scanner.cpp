@@ -0,0 +1,202 @@
+/**
+ * Copyright 2026 Hagen Möbius
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+**/
+
+
+#include <cstdint>
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__)) && defined(__SSE2__)
+#define XML_PARSER__SCANNER_X86
+#include <immintrin.h>
+#endif
+
+#include <xml_parser/scanner.h>
+
+namespace
+{
+    template<std::size_t NeedleCount>
+    auto FindScalar(XML::Scanner const & Scanner, char const * Begin, char const * End) -> char const *
+    {
+        auto const Needles = Scanner.GetNeedles();
+        
+        for(; Begin != End; ++Begin)
+        {
+            for(auto NeedleIndex = std::size_t{0}; NeedleIndex < NeedleCount; ++NeedleIndex)
+            {
+                if(*Begin == Needles[NeedleIndex])
+                {
+                    return Begin;
+                }
+            }
+        }
+        
+        return End;
+    }
+    
+#if defined(XML_PARSER__SCANNER_X86)
+    template<std::size_t NeedleCount>
+    auto FindSSE2(XML::Scanner const & Scanner, char const * Begin, char const * End) -> char const *
+    {
+        auto const Needles = Scanner.GetNeedles();
+        
+        __m128i NeedleVectors[NeedleCount];
+        
+        for(auto NeedleIndex = std::size_t{0}; NeedleIndex < NeedleCount; ++NeedleIndex)
+        {
+            NeedleVectors[NeedleIndex] = _mm_set1_epi8(Needles[NeedleIndex]);
+        }
+        while(End - Begin >= 16)
+        {
+            auto const Characters = _mm_loadu_si128(reinterpret_cast<__m128i const *>(Begin));
+            auto Matches = _mm_cmpeq_epi8(Characters, NeedleVectors[0]);
+            
+            for(auto NeedleIndex = std::size_t{1}; NeedleIndex < NeedleCount; ++NeedleIndex)
+            {
+                Matches = _mm_or_si128(Matches, _mm_cmpeq_epi8(Characters, NeedleVectors[NeedleIndex]));
+            }
+            
+            auto const Mask = static_cast<std::uint32_t>(_mm_movemask_epi8(Matches));
+            
+            if(Mask != 0)
+            {
+                return Begin + __builtin_ctz(Mask);
+            }
+            Begin += 16;
+        }
+        
+        return FindScalar<NeedleCount>(Scanner, Begin, End);
+    }
+    
+    template<std::size_t NeedleCount>
+    __attribute__((target("avx2"))) auto FindAVX2(XML::Scanner const & Scanner, char const * Begin, char const * End) -> char const *
+    {
+        auto const Needles = Scanner.GetNeedles();
+        
+        __m256i NeedleVectors[NeedleCount];
+        
+        for(auto NeedleIndex = std::size_t{0}; NeedleIndex < NeedleCount; ++NeedleIndex)
+        {
+            NeedleVectors[NeedleIndex] = _mm256_set1_epi8(Needles[NeedleIndex]);
+        }
+        while(End - Begin >= 32)
+        {
+            auto const Characters = _mm256_loadu_si256(reinterpret_cast<__m256i const *>(Begin));
+            auto Matches = _mm256_cmpeq_epi8(Characters, NeedleVectors[0]);
+            
+            for(auto NeedleIndex = std::size_t{1}; NeedleIndex < NeedleCount; ++NeedleIndex)
+            {
+                Matches = _mm256_or_si256(Matches, _mm256_cmpeq_epi8(Characters, NeedleVectors[NeedleIndex]));
+            }
+            
+            auto const Mask = static_cast<std::uint32_t>(_mm256_movemask_epi8(Matches));
+            
+            if(Mask != 0)
+            {
+                return Begin + __builtin_ctz(Mask);
+            }
+            Begin += 32;
+        }
+        // the compiler leaves this out before the tail call, and every SSE instruction after it would pay for the dirty upper halves
+        _mm256_zeroupper();
+        
+        return FindSSE2<NeedleCount>(Scanner, Begin, End);
+    }
+#endif
+    
+    template<std::size_t NeedleCount>
+    auto SelectFind() -> XML::Scanner::FindFunction
+    {
+#if defined(XML_PARSER__SCANNER_X86)
+        __builtin_cpu_init();
+        if(__builtin_cpu_supports("avx2"))
+        {
+            return FindAVX2<NeedleCount>;
+        }
+        else
+        {
+            return FindSSE2<NeedleCount>;
+        }
+#else
+        return FindScalar<NeedleCount>;
+#endif
+    }
+}
+
+auto XML::Scanner::ResolveFind(XML::Scanner const & Scanner, char const * Begin, char const * End) -> char const *
+{
+    auto Find = XML::Scanner::FindFunction{nullptr};
+    
+    switch(Scanner.m_NeedleCount)
+    {
+    case 1:
+        {
+            Find = SelectFind<1>();
+            
+            break;
+        }
+    case 2:
+        {
+            Find = SelectFind<2>();
+            
+            break;
+        }
+    case 3:
+        {
+            Find = SelectFind<3>();
+            
+            break;
+        }
+    case 4:
+        {
+            Find = SelectFind<4>();
+            
+            break;
+        }
+    case 5:
+        {
+            Find = SelectFind<5>();
+            
+            break;
+        }
+    case 6:
+        {
+            Find = SelectFind<6>();
+            
+            break;
+        }
+    case 7:
+        {
+            Find = SelectFind<7>();
+            
+            break;
+        }
+    default:
+        {
+            Find = SelectFind<8>();
+            
+            break;
+        }
+    }
+    // all threads that get here select the same kernel, so it does not matter which store wins
+    Scanner.m_Find.store(Find, std::memory_order_relaxed);
+    
+    return Find(Scanner, Begin, End);
+}
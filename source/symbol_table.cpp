@@ -0,0 +1,74 @@
+/**
+ * Copyright 2026 Hagen Möbius
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+**/
+
+
+#include <cassert>
+#include <stdexcept>
+
+#include <xml_parser/symbol_table.h>
+
+auto XML::SymbolTable::Find(std::string_view Name) const -> std::optional<XML::SymbolId>
+{
+    auto const Iterator = m_Ids.find(Name);
+    
+    if(Iterator != m_Ids.end())
+    {
+        return Iterator->second;
+    }
+    else
+    {
+        return std::nullopt;
+    }
+}
+
+auto XML::SymbolTable::GetName(XML::SymbolId Id) const -> std::string_view
+{
+    assert(Id < m_Names.size());
+    
+    return m_Names[Id];
+}
+
+auto XML::SymbolTable::GetSize() const -> std::size_t
+{
+    return m_Names.size();
+}
+
+auto XML::SymbolTable::Intern(std::string_view Name) -> XML::SymbolId
+{
+    auto const Iterator = m_Ids.find(Name);
+    
+    if(Iterator != m_Ids.end())
+    {
+        return Iterator->second;
+    }
+    if(m_Names.size() == XML::NoSymbol)
+    {
+        throw std::length_error{"The symbol table is full."};
+    }
+    
+    auto const Id = static_cast<XML::SymbolId>(m_Names.size());
+    
+    m_Names.emplace_back(Name);
+    m_Ids.emplace(m_Names.back(), Id);
+    
+    return Id;
+}
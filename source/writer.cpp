@@ -0,0 +1,258 @@
+/**
+ * Copyright 2026 Hagen Möbius
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+**/
+
+#include <cassert>
+#include <cerrno>
+#include <fcntl.h>
+#include <stdexcept>
+#include <unistd.h>
+
+#include <xml_parser/scanner.h>
+#include <xml_parser/writer.h>
+
+namespace
+{
+    constinit XML::Scanner const AttributeValueEscapeScanner{"&<>\"'"};
+    constinit XML::Scanner const TextEscapeScanner{"&<>"};
+    
+    auto GetEscape(char Character) -> std::string_view
+    {
+        switch(Character)
+        {
+        case '&':
+            {
+                return "&amp;";
+            }
+        case '<':
+            {
+                return "&lt;";
+            }
+        case '>':
+            {
+                return "&gt;";
+            }
+        case '"':
+            {
+                return "&quot;";
+            }
+        case '\'':
+            {
+                return "&apos;";
+            }
+        }
+        
+        return {};
+    }
+}
+
+XML::Writer::Writer(std::string & Output) :
+    m_BufferSize{0},
+    m_FileDescriptor{-1},
+    m_Output{&Output},
+    m_OwnsFileDescriptor{false},
+    m_StartTagOpen{false}
+{
+}
+
+XML::Writer::Writer(int FileDescriptor, std::size_t BufferSize) :
+    m_BufferSize{BufferSize},
+    m_FileDescriptor{FileDescriptor},
+    m_Output{&m_Buffer},
+    m_OwnsFileDescriptor{false},
+    m_StartTagOpen{false}
+{
+    m_Buffer.reserve(m_BufferSize);
+}
+
+XML::Writer::Writer(std::filesystem::path const & Path, std::size_t BufferSize) :
+    Writer{open(Path.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0666), BufferSize}
+{
+    if(m_FileDescriptor == -1)
+    {
+        throw std::runtime_error{"Could not open the file \"" + Path.string() + "\"."};
+    }
+    m_OwnsFileDescriptor = true;
+}
+
+XML::Writer::~Writer()
+{
+    if(m_FileDescriptor != -1)
+    {
+        WriteAll(m_Buffer.data(), m_Buffer.data() + m_Buffer.size());
+        if(m_OwnsFileDescriptor == true)
+        {
+            close(m_FileDescriptor);
+        }
+    }
+}
+
+auto XML::Writer::Attribute(std::string_view Name, std::string_view Value) -> void
+{
+    assert(m_StartTagOpen == true);
+    Append(' ');
+    Append(Name);
+    Append("=\"");
+    AppendEscaped(Value, true);
+    Append('"');
+}
+
+auto XML::Writer::Comment(std::string_view Comment) -> void
+{
+    if((Comment.find("--") != std::string_view::npos) || (Comment.ends_with('-') == true))
+    {
+        throw std::invalid_argument{"The comment \"" + std::string{Comment} + "\" contains \"--\" or ends with '-'."};
+    }
+    CloseStartTag();
+    Append("<!--");
+    Append(Comment);
+    Append("-->");
+}
+
+auto XML::Writer::ElementEnd() -> void
+{
+    assert(m_NameLengths.empty() == false);
+    
+    auto const NameBegin = m_Names.size() - m_NameLengths.back();
+    
+    if(m_StartTagOpen == true)
+    {
+        Append("/>");
+        m_StartTagOpen = false;
+    }
+    else
+    {
+        Append("</");
+        Append(std::string_view{m_Names}.substr(NameBegin));
+        Append('>');
+    }
+    m_Names.resize(NameBegin);
+    m_NameLengths.pop_back();
+}
+
+auto XML::Writer::ElementStart(std::string_view TagName, XML::Attributes Attributes) -> void
+{
+    CloseStartTag();
+    Append('<');
+    Append(TagName);
+    m_Names.append(TagName);
+    m_NameLengths.push_back(TagName.size());
+    m_StartTagOpen = true;
+    for(auto const & Attribute : Attributes)
+    {
+        this->Attribute(Attribute.Name, Attribute.Value);
+    }
+}
+
+auto XML::Writer::Flush() -> void
+{
+    if(m_FileDescriptor != -1)
+    {
+        if(WriteAll(m_Buffer.data(), m_Buffer.data() + m_Buffer.size()) == false)
+        {
+            throw std::runtime_error{"Could not write the output."};
+        }
+        m_Buffer.clear();
+    }
+}
+
+auto XML::Writer::Text(std::string_view Text) -> void
+{
+    CloseStartTag();
+    AppendEscaped(Text, false);
+}
+
+/**
+ * The scanner skips over the runs of characters that need no escaping at 16 or 32 characters per
+ * step, so that the runs are copied as a whole.
+ **/
+auto XML::Writer::AppendEscaped(std::string_view Characters, bool AttributeValue) -> void
+{
+    auto const & Scanner = (AttributeValue == true) ? AttributeValueEscapeScanner : TextEscapeScanner;
+    auto Begin = Characters.data();
+    auto const End = Characters.data() + Characters.size();
+    
+    while(Begin != End)
+    {
+        auto const Special = Scanner.Find(Begin, End);
+        
+        Append(Begin, Special);
+        if(Special != End)
+        {
+            auto const Escape = GetEscape(*Special);
+            
+            Append(Escape);
+            Begin = Special + 1;
+        }
+        else
+        {
+            Begin = End;
+        }
+    }
+}
+
+/**
+ * Flushes the buffer before it would grow beyond its size. Characters that would fill the buffer
+ * on their own are written without copying them.
+ **/
+auto XML::Writer::AppendBeyondBuffer(char const * Begin, char const * End) -> void
+{
+    Flush();
+    if(static_cast<std::size_t>(End - Begin) >= m_BufferSize)
+    {
+        if(WriteAll(Begin, End) == false)
+        {
+            throw std::runtime_error{"Could not write the output."};
+        }
+    }
+    else
+    {
+        m_Output->append(Begin, static_cast<std::size_t>(End - Begin));
+    }
+}
+
+auto XML::Writer::CloseStartTag() -> void
+{
+    if(m_StartTagOpen == true)
+    {
+        Append('>');
+        m_StartTagOpen = false;
+    }
+}
+
+auto XML::Writer::WriteAll(char const * Begin, char const * End) -> bool
+{
+    while(Begin != End)
+    {
+        auto const Written = write(m_FileDescriptor, Begin, End - Begin);
+        
+        if(Written >= 0)
+        {
+            Begin += Written;
+        }
+        else if(errno != EINTR)
+        {
+            return false;
+        }
+    }
+    
+    return true;
+}
@@ -1,5 +1,5 @@
 /**
- * Copyright 2021-2022 Hagen Möbius
+ * Copyright 2021-2026 Hagen Möbius
  * 
  * Permission is hereby granted, free of charge, to any person obtaining a copy
  * of this software and associated documentation files (the "Software"), to
@@ -20,12 +20,38 @@
  * IN THE SOFTWARE.
 **/
 
+#include <algorithm>
 #include <cassert>
+#include <filesystem>
 #include <format>
+#include <fstream>
+#include <functional>
 #include <iostream>
+#include <iterator>
+#include <optional>
+#include <ranges>
 #include <sstream>
+#include <vector>
+#define ZLIB_CONST
+#include <zlib.h>
 
+#include <xml_parser/basic_parser.h>
+#include <xml_parser/batch_parser.h>
+#include <xml_parser/compressed_input_source.h>
+#include <xml_parser/document.h>
+#include <xml_parser/element_index.h>
+#include <xml_parser/entities.h>
+#include <xml_parser/event_cache.h>
+#include <xml_parser/event_stream.h>
+#include <xml_parser/indexed_document.h>
+#include <xml_parser/line_index.h>
+#include <xml_parser/parallel_parser.h>
 #include <xml_parser/parser.h>
+#include <xml_parser/path_dispatcher.h>
+#include <xml_parser/reader.h>
+#include <xml_parser/statistics.h>
+#include <xml_parser/symbol_table.h>
+#include <xml_parser/writer.h>
 
 class ContentParser : public XML::Parser
 {
@@ -68,75 +94,1609 @@ private:
     std::string m_Result;
 };
 
+class ContentViewParser : public XML::Parser
+{
+public:
+    ContentViewParser() = default;
+    
+    ContentViewParser(std::unique_ptr<XML::InputSource> InputSource) :
+        XML::Parser{std::move(InputSource)}
+    {
+    }
+    
+    std::string const & GetResult() const
+    {
+        return m_Result;
+    }
+private:
+    auto CommentView(std::string_view Comment, [[maybe_unused]] XML::Location const & StartLocation) -> void override
+    {
+        m_Result += '{';
+        m_Result += Comment;
+        m_Result += '}';
+    }
+    
+    auto ElementStartView(std::string_view TagName, XML::Attributes Attributes, [[maybe_unused]] XML::Location const & StartLocation) -> void override
+    {
+        m_Result += "[+";
+        m_Result += TagName;
+        for(auto & Attribute : Attributes)
+        {
+            m_Result += '|';
+            m_Result += Attribute.Name;
+            m_Result += '=';
+            m_Result += Attribute.Value;
+        }
+        m_Result += ']';
+    }
+    
+    auto ElementEndView(std::string_view TagName) -> void override
+    {
+        m_Result += "[-";
+        m_Result += TagName;
+        m_Result += ']';
+    }
+    
+    auto TextView(std::string_view Text, [[maybe_unused]] XML::Location const & StartLocation) -> void override
+    {
+        m_Result += '(';
+        m_Result += Text;
+        m_Result += ')';
+    }
+    
+    std::string m_Result;
+};
+
+class ContentHandler
+{
+public:
+    auto Comment(std::string_view Comment, [[maybe_unused]] XML::Location const & StartLocation) -> void
+    {
+        m_Result += '{';
+        m_Result += Comment;
+        m_Result += '}';
+    }
+    
+    auto ElementStart(std::string_view TagName, XML::Attributes Attributes, [[maybe_unused]] XML::Location const & StartLocation) -> void
+    {
+        m_Result += "[+";
+        m_Result += TagName;
+        for(auto & Attribute : Attributes)
+        {
+            m_Result += '|';
+            m_Result += Attribute.Name;
+            m_Result += '=';
+            m_Result += Attribute.Value;
+        }
+        m_Result += ']';
+    }
+    
+    auto ElementEnd(std::string_view TagName) -> void
+    {
+        m_Result += "[-";
+        m_Result += TagName;
+        m_Result += ']';
+    }
+    
+    auto Text(std::string_view Text, [[maybe_unused]] XML::Location const & StartLocation) -> void
+    {
+        m_Result += '(';
+        m_Result += Text;
+        m_Result += ')';
+    }
+    
+    std::string const & GetResult() const
+    {
+        return m_Result;
+    }
+private:
+    std::string m_Result;
+};
+
+/**
+ * Records the content like the content handler, but lets the parser skip the elements with the
+ * given name.
+ **/
+class SkipHandler : public ContentHandler
+{
+public:
+    SkipHandler(std::string_view SkipName) :
+        m_SkipName{SkipName}
+    {
+    }
+    
+    auto ElementStart(XML::Name TagName, XML::Attributes Attributes, XML::Location const & StartLocation) -> void
+    {
+        ContentHandler::ElementStart(TagName, Attributes, StartLocation);
+        if(TagName.Text == m_SkipName)
+        {
+            m_Parser->SkipElement();
+        }
+    }
+    
+    auto SetParser(XML::BasicParser<SkipHandler> * Parser) -> void
+    {
+        m_Parser = Parser;
+    }
+private:
+    XML::BasicParser<SkipHandler> * m_Parser = nullptr;
+    std::string_view m_SkipName;
+};
+
+/**
+ * Joins the fragments of texts and comments and records them like the content handler. The
+ * fragments themselves are recorded separately, each followed by a '|', with a ';' after the last
+ * one of a node.
+ **/
+class FragmentHandler : public ContentHandler
+{
+public:
+    FragmentHandler(std::size_t FragmentSize) :
+        m_FragmentSize{FragmentSize}
+    {
+    }
+    
+    auto CommentFragment(std::string_view Fragment, XML::Location const & StartLocation, bool First, bool Last) -> void
+    {
+        if(AppendFragment(Fragment, StartLocation, First, Last) == true)
+        {
+            ContentHandler::Comment(m_Node, StartLocation);
+        }
+    }
+    
+    auto GetFragments() const -> std::string const &
+    {
+        return m_Fragments;
+    }
+    
+    auto TextFragment(std::string_view Fragment, XML::Location const & StartLocation, bool First, bool Last) -> void
+    {
+        if(AppendFragment(Fragment, StartLocation, First, Last) == true)
+        {
+            ContentHandler::Text(m_Node, StartLocation);
+        }
+    }
+private:
+    auto AppendFragment(std::string_view Fragment, XML::Location const & StartLocation, bool First, bool Last) -> bool
+    {
+        if((First == m_InNode) || (Fragment.size() > m_FragmentSize) || ((First == false) && (StartLocation.Offset != m_StartOffset)))
+        {
+            throw std::runtime_error{std::format("The fragment \"{}\" does not continue the fragments \"{}\".", Fragment, m_Fragments)};
+        }
+        if(First == true)
+        {
+            m_Node.clear();
+            m_StartOffset = StartLocation.Offset;
+        }
+        m_Node += Fragment;
+        m_Fragments += Fragment;
+        m_Fragments += (Last == true) ? ';' : '|';
+        m_InNode = !Last;
+        
+        return Last;
+    }
+    
+    std::size_t m_FragmentSize;
+    std::string m_Fragments;
+    bool m_InNode = false;
+    std::string m_Node;
+    std::uint64_t m_StartOffset = 0;
+};
+
+/**
+ * Records the locations of all events that have one.
+ **/
+class LocationHandler
+{
+public:
+    auto Comment([[maybe_unused]] std::string_view Comment, XML::Location const & StartLocation) -> void
+    {
+        m_Locations.push_back(StartLocation);
+    }
+    
+    auto ElementStart([[maybe_unused]] std::string_view TagName, [[maybe_unused]] XML::Attributes Attributes, XML::Location const & StartLocation) -> void
+    {
+        m_Locations.push_back(StartLocation);
+    }
+    
+    auto Text([[maybe_unused]] std::string_view Text, XML::Location const & StartLocation) -> void
+    {
+        m_Locations.push_back(StartLocation);
+    }
+    
+    std::vector<XML::Location> const & GetLocations() const
+    {
+        return m_Locations;
+    }
+private:
+    std::vector<XML::Location> m_Locations;
+};
+
+/**
+ * Passes the events on to a writer.
+ **/
+class WritingHandler
+{
+public:
+    WritingHandler(XML::Writer & Writer) :
+        m_Writer{Writer}
+    {
+    }
+    
+    auto Comment(std::string_view Comment, [[maybe_unused]] XML::Location const & StartLocation) -> void
+    {
+        m_Writer.Comment(Comment);
+    }
+    
+    auto ElementStart(std::string_view TagName, XML::Attributes Attributes, [[maybe_unused]] XML::Location const & StartLocation) -> void
+    {
+        m_Writer.ElementStart(TagName, Attributes);
+    }
+    
+    auto ElementEnd([[maybe_unused]] std::string_view TagName) -> void
+    {
+        m_Writer.ElementEnd();
+    }
+    
+    auto Text(std::string_view Text, [[maybe_unused]] XML::Location const & StartLocation) -> void
+    {
+        m_Writer.Text(Text);
+    }
+private:
+    XML::Writer & m_Writer;
+};
+
+/**
+ * Only handles element starts, the basic parser skips the other events.
+ **/
+class ElementCountHandler
+{
+public:
+    auto ElementStart([[maybe_unused]] std::string_view TagName, [[maybe_unused]] XML::Attributes Attributes, [[maybe_unused]] XML::Location const & StartLocation) -> void
+    {
+        ++m_Count;
+    }
+    
+    std::size_t GetCount() const
+    {
+        return m_Count;
+    }
+private:
+    std::size_t m_Count = 0;
+};
+
+/**
+ * Writes the symbol ids instead of the names.
+ **/
+class SymbolHandler
+{
+public:
+    auto ElementStart(XML::Name TagName, XML::Attributes Attributes, [[maybe_unused]] XML::Location const & StartLocation) -> void
+    {
+        m_Result += std::format("[+{}", TagName.Id);
+        for(auto & Attribute : Attributes)
+        {
+            m_Result += std::format("|{}", Attribute.NameId);
+        }
+        m_Result += ']';
+    }
+    
+    auto ElementEnd(XML::Name TagName) -> void
+    {
+        m_Result += std::format("[-{}]", TagName.Id);
+    }
+    
+    std::string const & GetResult() const
+    {
+        return m_Result;
+    }
+private:
+    std::string m_Result;
+};
+
 class PositionParser : public XML::Parser
 {
-public:
-    PositionParser(std::istream & InputStream) :
-        XML::Parser{InputStream}
+public:
+    PositionParser(std::istream & InputStream) :
+        XML::Parser{InputStream}
+    {
+    }
+    
+    std::string const & GetResult() const
+    {
+        return m_Result;
+    }
+private:
+    auto Comment(std::string const & Comment, XML::Location const & StartLocation) -> void override
+    {
+        m_Result += std::format("{}:{}#{}", StartLocation.Line, StartLocation.Column, Comment);
+    }
+    
+    auto ElementStart(std::string const & TagName, [[maybe_unused]] std::map<std::string, std::string> const & Attributes, XML::Location const & StartLocation) -> void override
+    {
+        m_Result += std::format("{}:{}+{}", StartLocation.Line, StartLocation.Column, TagName);
+    }
+    
+    auto ElementEnd([[maybe_unused]] std::string const & TagName) -> void override
+    {
+    }
+    
+    auto Text(std::string const & Text, XML::Location const & StartLocation) -> void override
+    {
+        m_Result += std::format("{}:{}={}", StartLocation.Line, StartLocation.Column, Text);
+    }
+    
+    std::string m_Result;
+};
+
+/**
+ * Writes the events together with their locations.
+ **/
+class PositionHandler
+{
+public:
+    auto Comment(std::string_view Comment, XML::Location const & StartLocation) -> void
+    {
+        m_Result += std::format("{}:{}#{}", StartLocation.Line, StartLocation.Column, Comment);
+    }
+    
+    auto ElementStart(std::string_view TagName, XML::Attributes Attributes, XML::Location const & StartLocation) -> void
+    {
+        m_Result += std::format("{}:{}+{}", StartLocation.Line, StartLocation.Column, TagName);
+        for(auto & Attribute : Attributes)
+        {
+            m_Result += std::format("|{}={}", Attribute.Name, Attribute.Value);
+        }
+    }
+    
+    auto ElementEnd(std::string_view TagName) -> void
+    {
+        m_Result += std::format("-{}", TagName);
+    }
+    
+    auto Text(std::string_view Text, XML::Location const & StartLocation) -> void
+    {
+        m_Result += std::format("{}:{}={}", StartLocation.Line, StartLocation.Column, Text);
+    }
+    
+    std::string const & GetResult() const
+    {
+        return m_Result;
+    }
+private:
+    std::string m_Result;
+};
+
+/**
+ * Parses while the objects at namespace scope are initialized, which may happen before the library's
+ * own objects at namespace scope are dynamically initialized.
+ **/
+auto ParseDuringInitialization() -> std::string
+{
+    static char const XMLString[] = "<a x=\"1\">hello<!-- comment --></a>";
+    auto Parser = ContentViewParser{std::make_unique<XML::MemoryInputSource>(std::span<char const>{XMLString, sizeof(XMLString) - 1})};
+    
+    Parser.Parse();
+    
+    return Parser.GetResult();
+}
+
+auto const InitializationResult = ParseDuringInitialization();
+
+/**
+ * A block size of zero means that the whole input is given to the parser as one block.
+ **/
+auto MakeInputSource(std::string const & XMLString, std::stringstream & XMLStream, std::size_t BlockSize) -> std::unique_ptr<XML::InputSource>
+{
+    if(BlockSize == 0)
+    {
+        return std::make_unique<XML::MemoryInputSource>(XMLString);
+    }
+    else
+    {
+        return std::make_unique<XML::StreamInputSource>(XMLStream, BlockSize);
+    }
+}
+
+auto ReadContent(XML::Reader & Reader, std::string_view SkipName = {}) -> std::string
+{
+    auto Result = std::string{};
+    
+    while(Reader.Next() != XML::EventKind::End)
+    {
+        switch(Reader.GetEventKind())
+        {
+        case XML::EventKind::Comment:
+            {
+                Result += '{';
+                Result += Reader.GetText();
+                Result += '}';
+                
+                break;
+            }
+        case XML::EventKind::ElementEnd:
+            {
+                Result += "[-";
+                Result += Reader.GetName();
+                Result += ']';
+                
+                break;
+            }
+        case XML::EventKind::ElementStart:
+            {
+                Result += "[+";
+                Result += Reader.GetName();
+                for(auto & Attribute : Reader.GetAttributes())
+                {
+                    Result += '|';
+                    Result += Attribute.Name;
+                    Result += '=';
+                    Result += Attribute.Value;
+                }
+                Result += ']';
+                if(Reader.GetName() == SkipName)
+                {
+                    Reader.SkipElement();
+                }
+                
+                break;
+            }
+        case XML::EventKind::End:
+            {
+                break;
+            }
+        case XML::EventKind::Text:
+            {
+                Result += '(';
+                Result += Reader.GetText();
+                Result += ')';
+                
+                break;
+            }
+        }
+    }
+    
+    return Result;
+}
+
+auto WriteContent(XML::Node const & Node, std::string & Result) -> void
+{
+    switch(Node.GetKind())
+    {
+    case XML::NodeKind::Comment:
+        {
+            Result += '{';
+            Result += Node.GetText();
+            Result += '}';
+            
+            break;
+        }
+    case XML::NodeKind::Document:
+        {
+            break;
+        }
+    case XML::NodeKind::Element:
+        {
+            Result += "[+";
+            Result += Node.GetName();
+            for(auto Index = std::uint32_t{0}; Index < Node.GetAttributeCount(); ++Index)
+            {
+                Result += '|';
+                Result += Node.GetAttribute(Index).Name;
+                Result += '=';
+                Result += Node.GetAttribute(Index).Value;
+            }
+            Result += ']';
+            
+            break;
+        }
+    case XML::NodeKind::Text:
+        {
+            Result += '(';
+            Result += Node.GetText();
+            Result += ')';
+            
+            break;
+        }
+    }
+    for(auto Child = Node.GetFirstChild(); Child.has_value() == true; Child = Child->GetNextSibling())
+    {
+        WriteContent(Child.value(), Result);
+    }
+    if(Node.GetKind() == XML::NodeKind::Element)
+    {
+        Result += "[-";
+        Result += Node.GetName();
+        Result += ']';
+    }
+}
+
+auto ReadEventContent(XML::Generator<XML::Event> Events) -> std::string
+{
+    auto Result = std::string{};
+    
+    for(auto const & Event : Events)
+    {
+        switch(Event.Kind)
+        {
+        case XML::EventKind::Comment:
+            {
+                Result += '{';
+                Result += Event.Text;
+                Result += '}';
+                
+                break;
+            }
+        case XML::EventKind::ElementEnd:
+            {
+                Result += "[-";
+                Result += Event.Name;
+                Result += ']';
+                
+                break;
+            }
+        case XML::EventKind::ElementStart:
+            {
+                Result += "[+";
+                Result += Event.Name;
+                for(auto & Attribute : Event.Attributes)
+                {
+                    Result += '|';
+                    Result += Attribute.Name;
+                    Result += '=';
+                    Result += Attribute.Value;
+                }
+                Result += ']';
+                
+                break;
+            }
+        case XML::EventKind::End:
+            {
+                break;
+            }
+        case XML::EventKind::Text:
+            {
+                Result += '(';
+                Result += Event.Text;
+                Result += ')';
+                
+                break;
+            }
+        }
+    }
+    
+    return Result;
+}
+
+auto TestContent(std::string const & XMLString, std::string const & TestString) -> void
+{
+    //~ std::cout << ">>>> parsing \"" << XMLString << '"' << std::endl;
+    
+    auto XMLStream = std::stringstream{XMLString};
+    auto Parser = ContentParser{XMLStream};
+    
+    Parser.Parse();
+    
+    auto ResultString = Parser.GetResult();
+    
+    if(ResultString != TestString)
+    {
+        throw std::runtime_error{std::format("The XML string \"{}\" did not evaluate to the content test string:\n        Expected result: \"{}\"\n          Actual result: \"{}\"", XMLString, TestString, ResultString)};
+    }
+    
+    // the view callbacks and the reader are tested with the whole input in one block and with every possible split into blocks
+    for(auto BlockSize : {std::size_t{0}, std::size_t{1}, std::size_t{3}})
+    {
+        auto XMLViewStream = std::stringstream{XMLString};
+        auto ViewParser = ContentViewParser{MakeInputSource(XMLString, XMLViewStream, BlockSize)};
+        
+        ViewParser.Parse();
+        
+        auto ViewResultString = ViewParser.GetResult();
+        
+        if(ViewResultString != TestString)
+        {
+            throw std::runtime_error{std::format("The XML string \"{}\" did not evaluate to the content test string with the view callbacks and a block size of {}:\n        Expected result: \"{}\"\n          Actual result: \"{}\"", XMLString, BlockSize, TestString, ViewResultString)};
+        }
+        
+        auto XMLReaderStream = std::stringstream{XMLString};
+        auto Reader = XML::Reader{MakeInputSource(XMLString, XMLReaderStream, BlockSize)};
+        auto ReaderResultString = ReadContent(Reader);
+        
+        if(ReaderResultString != TestString)
+        {
+            throw std::runtime_error{std::format("The XML string \"{}\" did not evaluate to the content test string with the reader and a block size of {}:\n        Expected result: \"{}\"\n          Actual result: \"{}\"", XMLString, BlockSize, TestString, ReaderResultString)};
+        }
+        
+        auto XMLEventStream = std::stringstream{XMLString};
+        auto EventResultString = ReadEventContent(XML::ReadEvents(MakeInputSource(XMLString, XMLEventStream, BlockSize)));
+        
+        if(EventResultString != TestString)
+        {
+            throw std::runtime_error{std::format("The XML string \"{}\" did not evaluate to the content test string with the event stream and a block size of {}:\n        Expected result: \"{}\"\n          Actual result: \"{}\"", XMLString, BlockSize, TestString, EventResultString)};
+        }
+    }
+    // the basic parser with a handler
+    auto Handler = ContentHandler{};
+    auto BasicParser = XML::BasicParser<ContentHandler>{Handler, std::span<char const>{XMLString}};
+    
+    BasicParser.Parse();
+    
+    auto BasicResultString = Handler.GetResult();
+    
+    if(BasicResultString != TestString)
+    {
+        throw std::runtime_error{std::format("The XML string \"{}\" did not evaluate to the content test string with the basic parser:\n        Expected result: \"{}\"\n          Actual result: \"{}\"", XMLString, TestString, BasicResultString)};
+    }
+    // building a document
+    auto Document = XML::Document{};
+    auto DocumentBuilder = XML::DocumentBuilder{Document, std::span<char const>{XMLString}};
+    
+    DocumentBuilder.Parse();
+    
+    auto DocumentResultString = std::string{};
+    
+    WriteContent(Document.GetRoot(), DocumentResultString);
+    if(DocumentResultString != TestString)
+    {
+        throw std::runtime_error{std::format("The XML string \"{}\" did not evaluate to the content test string as a document:\n        Expected result: \"{}\"\n          Actual result: \"{}\"", XMLString, TestString, DocumentResultString)};
+    }
+    // feeding the input in chunks
+    for(auto ChunkSize : {std::size_t{1}, std::size_t{2}, std::size_t{5}})
+    {
+        auto FeedParser = ContentViewParser{};
+        
+        for(auto Offset = std::size_t{0}; Offset < XMLString.size(); Offset += ChunkSize)
+        {
+            FeedParser.Feed(std::span<char const>{XMLString}.subspan(Offset, std::min(ChunkSize, XMLString.size() - Offset)));
+        }
+        FeedParser.Finish();
+        
+        auto FeedResultString = FeedParser.GetResult();
+        
+        if(FeedResultString != TestString)
+        {
+            throw std::runtime_error{std::format("The XML string \"{}\" did not evaluate to the content test string when fed in chunks of {}:\n        Expected result: \"{}\"\n          Actual result: \"{}\"", XMLString, ChunkSize, TestString, FeedResultString)};
+        }
+    }
+    //~ std::cout << "<<<<" << std::endl;
+}
+
+auto TestPosition(std::string const & XMLString, std::string const & TestString) -> void
+{
+    //~ std::cout << ">>>> parsing \"" << XMLString << '"' << std::endl;
+    
+    auto XMLStream = std::stringstream{XMLString};
+    auto Parser = PositionParser{XMLStream};
+    
+    Parser.Parse();
+    
+    auto ResultString = Parser.GetResult();
+    
+    if(ResultString != TestString)
+    {
+        throw std::runtime_error{std::format("The XML string \"{}\" did not evaluate to the position test string:\n        Expected result: \"{}\"\n          Actual result: \"{}\"", XMLString, TestString, ResultString)};
+    }
+    
+    auto Reader = XML::Reader{std::span<char const>{XMLString}};
+    auto ReaderResultString = std::string{};
+    
+    while(Reader.Next() != XML::EventKind::End)
+    {
+        if(Reader.GetEventKind() == XML::EventKind::Comment)
+        {
+            ReaderResultString += std::format("{}:{}#{}", Reader.GetLocation().Line, Reader.GetLocation().Column, Reader.GetText());
+        }
+        else if(Reader.GetEventKind() == XML::EventKind::ElementStart)
+        {
+            ReaderResultString += std::format("{}:{}+{}", Reader.GetLocation().Line, Reader.GetLocation().Column, Reader.GetName());
+        }
+        else if(Reader.GetEventKind() == XML::EventKind::Text)
+        {
+            ReaderResultString += std::format("{}:{}={}", Reader.GetLocation().Line, Reader.GetLocation().Column, Reader.GetText());
+        }
+    }
+    if(ReaderResultString != TestString)
+    {
+        throw std::runtime_error{std::format("The XML string \"{}\" did not evaluate to the position test string with the reader:\n        Expected result: \"{}\"\n          Actual result: \"{}\"", XMLString, TestString, ReaderResultString)};
+    }
+    //~ std::cout << "<<<<" << std::endl;
+}
+
+auto TestFindAttribute(std::string const & XMLString, std::string_view Name, std::optional<std::string_view> TestValue) -> void
+{
+    auto Reader = XML::Reader{std::span<char const>{XMLString}};
+    
+    if(Reader.Next() != XML::EventKind::ElementStart)
+    {
+        throw std::runtime_error{std::format("The XML string \"{}\" did not start with an element.", XMLString)};
+    }
+    
+    auto const Value = Reader.GetAttributes().Find(Name);
+    
+    if(Value != TestValue)
+    {
+        throw std::runtime_error{std::format("The XML string \"{}\" did not yield the expected value for the attribute \"{}\":\n        Expected value: {}\n          Actual value: {}", XMLString, Name, TestValue.value_or("<none>"), Value.value_or("<none>"))};
+    }
+}
+
+auto TestSymbols() -> void
+{
+    auto SymbolTable = XML::SymbolTable{};
+    
+    // pre-seeding the table fixes the ids of the known names
+    if((SymbolTable.Intern("root") != 0) || (SymbolTable.Intern("id") != 1) || (SymbolTable.Intern("root") != 0))
+    {
+        throw std::runtime_error{"The symbol table did not assign the ids in order."};
+    }
+    
+    auto const XMLString = std::string{"<root id=\"1\"><child id=\"2\" name=\"x\"/><child/></root>"};
+    auto Handler = SymbolHandler{};
+    auto Parser = XML::BasicParser<SymbolHandler>{Handler, std::span<char const>{XMLString}};
+    
+    Parser.SetSymbolTable(&SymbolTable);
+    Parser.Parse();
+    if(Handler.GetResult() != "[+0|1][+2|1|3][-2][+2][-2][-0]")
+    {
+        throw std::runtime_error{std::format("The XML string \"{}\" did not yield the expected symbols: \"{}\"", XMLString, Handler.GetResult())};
+    }
+    if((SymbolTable.GetSize() != 4) || (SymbolTable.GetName(2) != "child") || (SymbolTable.Find("name") != 3) || (SymbolTable.Find("other").has_value() == true))
+    {
+        throw std::runtime_error{"The symbol table does not contain the expected names."};
+    }
+    
+    // the reader reports the same ids
+    auto Reader = XML::Reader{std::span<char const>{XMLString}};
+    
+    Reader.SetSymbolTable(&SymbolTable);
+    Reader.Next();
+    Reader.Next();
+    if((Reader.GetNameId() != 2) || (Reader.GetAttributes()[1].NameId != 3))
+    {
+        throw std::runtime_error{"The reader did not report the expected symbols."};
+    }
+    
+    // without a symbol table, names are not interned
+    auto UninternedReader = XML::Reader{std::span<char const>{XMLString}};
+    
+    UninternedReader.Next();
+    if((UninternedReader.GetNameId() != XML::NoSymbol) || (UninternedReader.GetAttributes()[0].NameId != XML::NoSymbol))
+    {
+        throw std::runtime_error{"The reader reported symbols without a symbol table."};
+    }
+}
+
+auto TestParallel() -> void
+{
+    // the comments and attribute values contain '<', so some chunks begin inside of them, and a stray '<' in front of a tag makes another chunk begin in the middle of that tag
+    auto XMLString = std::string{"<root>\n"};
+    
+    for(auto Index = 0; Index < 200; ++Index)
+    {
+        XMLString += std::format("\t<record id=\"{}\" note='a<b'>text &amp; more<!-- <comment> --><empty/>\n<!--<--><=<empty/><\n<b/></record>\n", Index);
+    }
+    XMLString += "</root>";
+    
+    auto Handler = PositionHandler{};
+    auto Parser = XML::BasicParser<PositionHandler>{Handler, std::span<char const>{XMLString}};
+    
+    Parser.Parse();
+    for(auto ThreadCount : {2u, 4u})
+    {
+        for(auto ChunkSize : {std::size_t{1}, std::size_t{7}, std::size_t{100}, std::size_t{100000}})
+        {
+            auto ParallelHandler = PositionHandler{};
+            auto ParallelParser = XML::ParallelParser<PositionHandler>{ParallelHandler, std::span<char const>{XMLString}, ThreadCount, ChunkSize};
+            
+            ParallelParser.Parse();
+            if(ParallelHandler.GetResult() != Handler.GetResult())
+            {
+                throw std::runtime_error{std::format("The parallel parser with {} threads and a chunk size of {} did not deliver the same events as the basic parser.", ThreadCount, ChunkSize)};
+            }
+        }
+    }
+}
+
+auto TestBatch() -> void
+{
+    auto XMLStrings = std::vector<std::string>{};
+    auto Paths = std::vector<std::filesystem::path>{};
+    
+    for(auto Index = 0; Index < 50; ++Index)
+    {
+        XMLStrings.push_back(std::format("<root index=\"{}\">{}<!-- {} --></root>", Index, std::string(Index, 'x'), Index));
+        Paths.push_back(std::filesystem::temp_directory_path() / std::format("xml_parser_test_{}.xml", Index));
+        
+        auto XMLFile = std::ofstream{Paths.back(), std::ios::binary};
+        
+        XMLFile << XMLStrings.back();
+    }
+    Paths.push_back(std::filesystem::temp_directory_path() / "xml_parser_test_missing.xml");
+    
+    auto Documents = std::vector<std::span<char const>>{XMLStrings.begin(), XMLStrings.end()};
+    
+    for(auto ThreadCount : {1u, 4u})
+    {
+        auto BatchParser = XML::BatchParser{[](std::size_t) { return ContentHandler{}; }, ThreadCount};
+        auto DocumentResults = BatchParser.Parse(Documents);
+        auto FileResults = BatchParser.Parse(Paths);
+        
+        for(auto Index = 0; Index < 50; ++Index)
+        {
+            auto const TestString = std::format("[+root|index={}]{}{}[-root]", Index, (Index > 0) ? std::format("({})", std::string(Index, 'x')) : "", std::format("{} {} {}", '{', Index, '}'));
+            
+            for(auto const & Result : {std::cref(DocumentResults[Index]), std::cref(FileResults[Index])})
+            {
+                if((Result.get().Exception != nullptr) || (Result.get().Handler->GetResult() != TestString))
+                {
+                    throw std::runtime_error{std::format("The batch parser with {} threads did not evaluate document {} to the content test string:\n        Expected result: \"{}\"\n          Actual result: \"{}\"", ThreadCount, Index, TestString, Result.get().Handler->GetResult())};
+                }
+            }
+        }
+        if(FileResults.back().Exception == nullptr)
+        {
+            throw std::runtime_error{"The batch parser did not report the missing file."};
+        }
+    }
+    for(auto Index = std::size_t{0}; Index < 50; ++Index)
+    {
+        std::filesystem::remove(Paths[Index]);
+    }
+}
+
+auto TestStatistics() -> void
+{
+    auto const XMLString = std::string{"<root a=\"1234\">text &amp; &lt;more&unknown;<child><grandchild b='12345678'/></child><!-- comment --><child/></root>"};
+    auto Statistics = XML::Statistics{};
+    auto Parser = ContentViewParser{std::make_unique<XML::MemoryInputSource>(XMLString)};
+    
+    Parser.SetStatistics(&Statistics);
+    Parser.Parse();
+    if((Statistics.BytesConsumed != XMLString.size()) || (Statistics.CommentCount != 1) || (Statistics.ElementStartCount != 4) || (Statistics.ElementEndCount != 4) || (Statistics.TextCount != 1) || (Statistics.EntityExpansionCount != 2) || (Statistics.Depth != 0) || (Statistics.MaximumDepth != 3) || (Statistics.MaximumTextSize != 21) || (Statistics.MaximumAttributeValueSize != 8))
+    {
+        throw std::runtime_error{std::format("The statistics of the XML string \"{}\" are not as expected: {} bytes, {} comments, {} element starts, {} element ends, {} texts, {} entity expansions, depth {}, maximum depth {}, maximum text size {}, maximum attribute value size {}", XMLString, Statistics.BytesConsumed, Statistics.CommentCount, Statistics.ElementStartCount, Statistics.ElementEndCount, Statistics.TextCount, Statistics.EntityExpansionCount, Statistics.Depth, Statistics.MaximumDepth, Statistics.MaximumTextSize, Statistics.MaximumAttributeValueSize)};
+    }
+    if(Statistics.CallbackDuration > Statistics.ParseDuration)
+    {
+        throw std::runtime_error{"More time was spent in the callbacks than in the parser."};
+    }
+}
+
+auto TestEventPipeline() -> void
+{
+    auto const XMLString = "<root><a/>text<b x=\"1\"/><!-- c --><a>" + std::string(1000, 'x') + "</a></root>";
+    auto Statistics = XML::Statistics{};
+    auto XMLStream = std::stringstream{XMLString};
+    auto Reader = XML::Reader{MakeInputSource(XMLString, XMLStream, 16)};
+    auto Names = std::string{};
+    
+    Reader.SetStatistics(&Statistics);
+    for(auto const & Event : XML::ReadEvents(Reader) | std::views::filter([](XML::Event const & Event) { return Event.Kind == XML::EventKind::ElementStart; }) | std::views::drop(1) | std::views::take(2))
+    {
+        Names += Event.Name;
+        Names += std::to_string(Event.Attributes.size());
+    }
+    // the pipeline stops the parser long before the large text
+    if((Names != "a0b1") || (Statistics.BytesConsumed >= XMLString.size() / 2))
+    {
+        throw std::runtime_error{std::format("The event pipeline yielded \"{}\" after consuming {} bytes.", Names, Statistics.BytesConsumed)};
+    }
+    
+    // the reader can skip elements while its events are yielded
+    auto XMLSkipStream = std::stringstream{XMLString};
+    auto SkipReader = XML::Reader{MakeInputSource(XMLString, XMLSkipStream, 16)};
+    auto Result = std::string{};
+    
+    for(auto const & Event : XML::ReadEvents(SkipReader))
+    {
+        if(Event.Kind == XML::EventKind::ElementStart)
+        {
+            Result += Event.Name;
+            if(Event.Name.Text == "a")
+            {
+                SkipReader.SkipElement();
+            }
+        }
+        else if(Event.Kind == XML::EventKind::Text)
+        {
+            Result += Event.Text;
+        }
+    }
+    if(Result != "rootatextba")
+    {
+        throw std::runtime_error{std::format("The event stream with skipped elements yielded \"{}\".", Result)};
+    }
+}
+
+auto TestSkip(std::string const & XMLString, std::string const & TestString) -> void
+{
+    for(auto BlockSize : {std::size_t{0}, std::size_t{1}, std::size_t{3}})
+    {
+        auto XMLStream = std::stringstream{XMLString};
+        auto Handler = SkipHandler{"skip"};
+        auto BasicParser = XML::BasicParser<SkipHandler>{Handler, MakeInputSource(XMLString, XMLStream, BlockSize)};
+        
+        Handler.SetParser(&BasicParser);
+        BasicParser.Parse();
+        if(Handler.GetResult() != TestString)
+        {
+            throw std::runtime_error{std::format("The XML string \"{}\" did not evaluate to the skip test string with a block size of {}:\n        Expected result: \"{}\"\n          Actual result: \"{}\"", XMLString, BlockSize, TestString, Handler.GetResult())};
+        }
+        
+        auto XMLReaderStream = std::stringstream{XMLString};
+        auto Reader = XML::Reader{MakeInputSource(XMLString, XMLReaderStream, BlockSize)};
+        auto ReaderResultString = ReadContent(Reader, "skip");
+        
+        if(ReaderResultString != TestString)
+        {
+            throw std::runtime_error{std::format("The XML string \"{}\" did not evaluate to the skip test string with the reader and a block size of {}:\n        Expected result: \"{}\"\n          Actual result: \"{}\"", XMLString, BlockSize, TestString, ReaderResultString)};
+        }
+    }
+}
+
+auto TestPaths() -> void
+{
+    auto const XMLString = std::string_view{"<feed><entry type=\"a\"><title>One</title><link/></entry><entry><title>Two</title><item type=\"b\"><title>Three</title></item></entry><!-- c --><item/></feed>"};
+    auto Result = std::string{};
+    auto Dispatcher = XML::PathDispatcher{std::span<char const>{XMLString}};
+    auto const Patterns = std::vector<std::string_view>{"/feed/entry/title", "//item[@type]", "//item[@type='b']", "/feed/*/title", "//title", "/entry", "//entry//title"};
+    
+    for(auto Index = std::size_t{0}; Index < Patterns.size(); ++Index)
+    {
+        auto Subscription = XML::PathSubscription{};
+        
+        Subscription.ElementStart = [&Result, Index](std::string_view TagName, XML::Attributes, XML::Location const &) { Result += std::format("{}+{} ", Index, TagName); };
+        Subscription.Text = [&Result, Index](std::string_view Text, XML::Location const &) { Result += std::format("{}={} ", Index, Text); };
+        Dispatcher.Subscribe(Patterns[Index], Subscription);
+    }
+    Dispatcher.Parse();
+    
+    auto const TestString = std::string_view{"0+title 3+title 6+title 4+title 0=One 3=One 6=One 4=One 0+title 3+title 6+title 4+title 0=Two 3=Two 6=Two 4=Two 1+item 2+item 6+title 4+title 6=Three 4=Three "};
+    
+    if(Result != TestString)
+    {
+        throw std::runtime_error{std::format("The path subscriptions resulted in:\n        Expected result: \"{}\"\n          Actual result: \"{}\"", TestString, Result)};
+    }
+    
+    // elements in which no pattern can match are skipped
+    auto Statistics = XML::Statistics{};
+    auto Texts = std::string{};
+    auto SkippingDispatcher = XML::PathDispatcher{std::span<char const>{XMLString}};
+    auto Subscription = XML::PathSubscription{};
+    
+    Subscription.Text = [&Texts](std::string_view Text, XML::Location const &) { Texts += Text; };
+    SkippingDispatcher.Subscribe("/feed/entry[@type]/title", Subscription);
+    SkippingDispatcher.SetStatistics(&Statistics);
+    SkippingDispatcher.Parse();
+    if((Texts != "One") || (Statistics.ElementStartCount != 6) || (Statistics.ElementEndCount != 6))
+    {
+        throw std::runtime_error{std::format("Skipping with path subscriptions resulted in \"{}\" with {} element starts.", Texts, Statistics.ElementStartCount)};
+    }
+    
+    // a stray end tag does not close the document level
+    auto const UnbalancedXMLString = std::string_view{"<a/></b><c>x</c>"};
+    auto UnbalancedResult = std::string{};
+    auto UnbalancedDispatcher = XML::PathDispatcher{std::span<char const>{UnbalancedXMLString}};
+    auto UnbalancedSubscription = XML::PathSubscription{};
+    
+    UnbalancedSubscription.ElementStart = [&UnbalancedResult](std::string_view TagName, XML::Attributes, XML::Location const &) { UnbalancedResult += std::format("+{} ", TagName); };
+    UnbalancedSubscription.Text = [&UnbalancedResult](std::string_view Text, XML::Location const &) { UnbalancedResult += std::format("={} ", Text); };
+    UnbalancedDispatcher.Subscribe("//c", UnbalancedSubscription);
+    UnbalancedDispatcher.Parse();
+    if(UnbalancedResult != "+c =x ")
+    {
+        throw std::runtime_error{std::format("The path subscriptions after a stray end tag resulted in \"{}\".", UnbalancedResult)};
+    }
+    for(auto Pattern : {"", "feed", "/", "/feed/", "/feed[@]", "/feed[@a", "/feed[@a=b]", "/feed[@a='b]", "/*x"})
+    {
+        auto Thrown = false;
+        
+        try
+        {
+            SkippingDispatcher.Subscribe(Pattern, Subscription);
+        }
+        catch(std::invalid_argument const &)
+        {
+            Thrown = true;
+        }
+        if(Thrown == false)
+        {
+            throw std::runtime_error{std::format("The malformed path pattern \"{}\" was accepted.", Pattern)};
+        }
+    }
+}
+
+auto TestLocations(std::string const & XMLString, std::vector<std::uint64_t> const & TestOffsets) -> void
+{
+    for(auto BlockSize : {std::size_t{0}, std::size_t{1}, std::size_t{3}})
     {
+        auto XMLStream = std::stringstream{XMLString};
+        auto Handler = LocationHandler{};
+        auto Parser = XML::BasicParser<LocationHandler>{Handler, MakeInputSource(XMLString, XMLStream, BlockSize)};
+        
+        Parser.Parse();
+        
+        auto XMLOffsetStream = std::stringstream{XMLString};
+        auto OffsetHandler = LocationHandler{};
+        auto OffsetParser = XML::BasicParser<LocationHandler>{OffsetHandler, MakeInputSource(XMLString, XMLOffsetStream, BlockSize)};
+        auto LineIndex = XML::LineIndex{};
+        
+        OffsetParser.SetLocationTracking(XML::LocationTracking::Offsets);
+        OffsetParser.SetLineIndex(&LineIndex);
+        OffsetParser.Parse();
+        
+        auto XMLNoneStream = std::stringstream{XMLString};
+        auto NoneHandler = LocationHandler{};
+        auto NoneParser = XML::BasicParser<LocationHandler>{NoneHandler, MakeInputSource(XMLString, XMLNoneStream, BlockSize)};
+        
+        NoneParser.SetLocationTracking(XML::LocationTracking::None);
+        NoneParser.Parse();
+        if((Handler.GetLocations().size() != TestOffsets.size()) || (OffsetHandler.GetLocations().size() != TestOffsets.size()) || (NoneHandler.GetLocations().size() != TestOffsets.size()) || (LineIndex.GetSize() != XMLString.size()))
+        {
+            throw std::runtime_error{std::format("The XML string \"{}\" did not yield {} locations with a block size of {}.", XMLString, TestOffsets.size(), BlockSize)};
+        }
+        for(auto Index = std::size_t{0}; Index < TestOffsets.size(); ++Index)
+        {
+            auto const & Location = Handler.GetLocations()[Index];
+            auto const & OffsetLocation = OffsetHandler.GetLocations()[Index];
+            auto const & NoneLocation = NoneHandler.GetLocations()[Index];
+            auto const Resolved = LineIndex.Resolve(OffsetLocation.Offset);
+            
+            if((Location.Offset != TestOffsets[Index]) || (OffsetLocation.Offset != TestOffsets[Index]) || (OffsetLocation.Line != 0) || (OffsetLocation.Column != 0) || (Resolved.Line != Location.Line) || (Resolved.Column != Location.Column) || (NoneLocation.Offset != 0) || (NoneLocation.Line != 0) || (NoneLocation.Column != 0))
+            {
+                throw std::runtime_error{std::format("The location {} of the XML string \"{}\" with a block size of {} is {}:{}@{}, {}:{}@{} with offsets only and {}:{} resolved, {}@{} expected.", Index, XMLString, BlockSize, Location.Line, Location.Column, Location.Offset, OffsetLocation.Line, OffsetLocation.Column, OffsetLocation.Offset, Resolved.Line, Resolved.Column, Index, TestOffsets[Index])};
+            }
+        }
     }
     
-    std::string const & GetResult() const
+    // offsets continue across fed chunks
+    auto Handler = LocationHandler{};
+    auto Parser = XML::BasicParser<LocationHandler>{Handler};
+    
+    Parser.SetLocationTracking(XML::LocationTracking::Offsets);
+    for(auto Offset = std::size_t{0}; Offset < XMLString.size(); Offset += 2)
     {
-        return m_Result;
+        Parser.Feed(std::span<char const>{XMLString}.subspan(Offset, std::min(std::size_t{2}, XMLString.size() - Offset)));
     }
-private:
-    auto Comment(std::string const & Comment, XML::Location const & StartLocation) -> void override
+    for(auto Index = std::size_t{0}; Index < TestOffsets.size(); ++Index)
     {
-        m_Result += std::format("{}:{}#{}", StartLocation.Line, StartLocation.Column, Comment);
+        if((Index >= Handler.GetLocations().size()) || (Handler.GetLocations()[Index].Offset != TestOffsets[Index]))
+        {
+            throw std::runtime_error{std::format("The location {} of the fed XML string \"{}\" has the wrong offset.", Index, XMLString)};
+        }
     }
+}
+
+auto TestFragments(std::string const & XMLString, std::size_t FragmentSize, std::string const & TestFragments) -> void
+{
+    auto Handler = ContentHandler{};
+    auto Parser = XML::BasicParser<ContentHandler>{Handler, std::span<char const>{XMLString}};
     
-    auto ElementStart(std::string const & TagName, [[maybe_unused]] std::map<std::string, std::string> const & Attributes, XML::Location const & StartLocation) -> void override
+    Parser.Parse();
+    for(auto BlockSize : {std::size_t{0}, std::size_t{1}, std::size_t{3}})
     {
-        m_Result += std::format("{}:{}+{}", StartLocation.Line, StartLocation.Column, TagName);
+        auto XMLStream = std::stringstream{XMLString};
+        auto FragmentResult = FragmentHandler{FragmentSize};
+        auto FragmentParser = XML::BasicParser<FragmentHandler>{FragmentResult, MakeInputSource(XMLString, XMLStream, BlockSize)};
+        
+        FragmentParser.SetFragmentSize(FragmentSize);
+        FragmentParser.Parse();
+        if(FragmentResult.GetResult() != Handler.GetResult())
+        {
+            throw std::runtime_error{std::format("The fragments of the XML string \"{}\" with a block size of {} did not join to the content:\n        Expected result: \"{}\"\n          Actual result: \"{}\"", XMLString, BlockSize, Handler.GetResult(), FragmentResult.GetResult())};
+        }
+        // only a single block gives fragments that do not depend on the block boundaries
+        if((BlockSize == 0) && (FragmentResult.GetFragments() != TestFragments))
+        {
+            throw std::runtime_error{std::format("The XML string \"{}\" did not evaluate to the fragment test string:\n        Expected result: \"{}\"\n          Actual result: \"{}\"", XMLString, TestFragments, FragmentResult.GetFragments())};
+        }
     }
+}
+
+auto TestRawEntities(std::string const & XMLString, std::string const & TestString) -> void
+{
+    auto Handler = ContentHandler{};
+    auto BasicParser = XML::BasicParser<ContentHandler>{Handler, std::span<char const>{XMLString}};
     
-    auto ElementEnd([[maybe_unused]] std::string const & TagName) -> void override
+    BasicParser.SetDecodeEntities(false);
+    BasicParser.Parse();
+    if(Handler.GetResult() != TestString)
     {
+        throw std::runtime_error{std::format("The XML string \"{}\" did not evaluate to the raw content test string:\n        Expected result: \"{}\"\n          Actual result: \"{}\"", XMLString, TestString, Handler.GetResult())};
     }
     
-    auto Text(std::string const & Text, XML::Location const & StartLocation) -> void override
+    auto XMLStream = std::stringstream{XMLString};
+    auto Reader = XML::Reader{MakeInputSource(XMLString, XMLStream, 1)};
+    
+    Reader.SetDecodeEntities(false);
+    
+    auto ReaderResultString = ReadContent(Reader);
+    
+    if(ReaderResultString != TestString)
     {
-        m_Result += std::format("{}:{}={}", StartLocation.Line, StartLocation.Column, Text);
+        throw std::runtime_error{std::format("The XML string \"{}\" did not evaluate to the raw content test string with the reader:\n        Expected result: \"{}\"\n          Actual result: \"{}\"", XMLString, TestString, ReaderResultString)};
     }
     
-    std::string m_Result;
-};
+    // decoding the raw content on demand has to give the same result as decoding while parsing
+    auto DecodeHandler = ContentHandler{};
+    auto DecodeParser = XML::BasicParser<ContentHandler>{DecodeHandler, std::span<char const>{XMLString}};
+    
+    DecodeParser.Parse();
+    
+    auto Buffer = std::string{};
+    auto DecodedString = XML::DecodeEntities(Handler.GetResult(), Buffer);
+    
+    if(DecodedString != DecodeHandler.GetResult())
+    {
+        throw std::runtime_error{std::format("The raw content of the XML string \"{}\" did not decode to the decoded content:\n        Expected result: \"{}\"\n          Actual result: \"{}\"", XMLString, DecodeHandler.GetResult(), DecodedString)};
+    }
+}
 
-auto TestContent(std::string const & XMLString, std::string const & TestString) -> void
+auto TestElementCount(std::string const & XMLString, std::size_t TestCount) -> void
 {
-    //~ std::cout << ">>>> parsing \"" << XMLString << '"' << std::endl;
+    auto Handler = ElementCountHandler{};
+    auto Parser = XML::BasicParser<ElementCountHandler>{Handler, std::span<char const>{XMLString}};
     
+    Parser.Parse();
+    if(Handler.GetCount() != TestCount)
+    {
+        throw std::runtime_error{std::format("The XML string \"{}\" did not contain the expected number of elements:\n        Expected count: {}\n          Actual count: {}", XMLString, TestCount, Handler.GetCount())};
+    }
+}
+
+auto TestElementIndex(std::string const & XMLString, std::string_view Path, std::uint64_t Ordinal, std::optional<std::string> const & TestString) -> void
+{
+    auto Index = XML::ElementIndex{};
     auto XMLStream = std::stringstream{XMLString};
-    auto Parser = ContentParser{XMLStream};
+    auto Reader = XML::Reader{MakeInputSource(XMLString, XMLStream, 1)};
+    
+    Reader.SetElementIndex(&Index);
+    while(Reader.Next() != XML::EventKind::End)
+    {
+    }
+    
+    // an index that ends just above the element leaves it out
+    auto const Depth = static_cast<std::size_t>(std::count(Path.begin(), Path.end(), '/'));
+    auto ShallowIndex = XML::ElementIndex{Depth - 1};
+    auto Handler = ElementCountHandler{};
+    auto Parser = XML::BasicParser<ElementCountHandler>{Handler, std::span<char const>{XMLString}};
     
+    Parser.SetElementIndex(&ShallowIndex);
     Parser.Parse();
+    if((Index.Find(Path, Ordinal).has_value() != TestString.has_value()) || (ShallowIndex.GetCount(Path) != 0) || (ShallowIndex.GetPaths().size() > Index.GetPaths().size()))
+    {
+        throw std::runtime_error{std::format("The element index of the XML string \"{}\" has the wrong entries for \"{}\" #{}.", XMLString, Path, Ordinal)};
+    }
     
-    auto ResultString = Parser.GetResult();
+    auto DocumentPath = std::filesystem::temp_directory_path() / "xml_parser_test.xml";
+    auto IndexPath = std::filesystem::temp_directory_path() / "xml_parser_test.xml.index";
     
-    if(ResultString != TestString)
     {
-        throw std::runtime_error{std::format("The XML string \"{}\" did not evaluate to the content test string:\n        Expected result: \"{}\"\n          Actual result: \"{}\"", XMLString, TestString, ResultString)};
+        auto XMLFile = std::ofstream{DocumentPath, std::ios::binary};
+        
+        XMLFile << XMLString;
     }
-    //~ std::cout << "<<<<" << std::endl;
+    Index.Save(IndexPath);
+    
+    auto Document = XML::IndexedDocument{DocumentPath, IndexPath};
+    auto ContentResult = ContentHandler{};
+    auto LocationResult = LocationHandler{};
+    auto Found = Document.ParseElement(ContentResult, Path, Ordinal);
+    
+    Document.ParseElement(LocationResult, Path, Ordinal);
+    if((Found != TestString.has_value()) || (Document.GetIndex().GetPaths() != Index.GetPaths()) || ((Found == true) && ((ContentResult.GetResult() != TestString.value()) || (LocationResult.GetLocations().front().Offset != Index.Find(Path, Ordinal)))))
+    {
+        throw std::runtime_error{std::format("The element \"{}\" #{} of the XML string \"{}\" did not evaluate to the content test string:\n        Expected result: \"{}\"\n          Actual result: \"{}\"", Path, Ordinal, XMLString, TestString.value_or("<none>"), ContentResult.GetResult())};
+    }
+    if(Found == true)
+    {
+        // the index no longer fits a changed document
+        {
+            auto XMLFile = std::ofstream{DocumentPath, std::ios::binary};
+            
+            XMLFile << ' ' << XMLString;
+        }
+        
+        auto ChangedDocument = XML::IndexedDocument{DocumentPath, IndexPath};
+        auto Thrown = false;
+        
+        try
+        {
+            ChangedDocument.ParseElement(ContentResult, Path, Ordinal);
+        }
+        catch(std::runtime_error const &)
+        {
+            Thrown = true;
+        }
+        if(Thrown == false)
+        {
+            throw std::runtime_error{std::format("The element \"{}\" #{} was parsed from a changed document.", Path, Ordinal)};
+        }
+    }
+    
+    // a truncated index is rejected instead of being partially loaded
+    std::filesystem::resize_file(IndexPath, std::filesystem::file_size(IndexPath) - 1);
+    
+    auto Thrown = false;
+    
+    try
+    {
+        Index.Load(IndexPath);
+    }
+    catch(std::runtime_error const &)
+    {
+        Thrown = true;
+    }
+    if((Thrown == false) || (Index.GetPaths().empty() == false))
+    {
+        throw std::runtime_error{std::format("The truncated element index of the XML string \"{}\" was loaded.", XMLString)};
+    }
+    std::filesystem::remove(DocumentPath);
+    std::filesystem::remove(IndexPath);
 }
 
-auto TestPosition(std::string const & XMLString, std::string const & TestString) -> void
+auto TestWriter(std::string const & XMLString, std::string const & TestString) -> void
 {
-    //~ std::cout << ">>>> parsing \"" << XMLString << '"' << std::endl;
+    auto Output = std::string{};
     
-    auto XMLStream = std::stringstream{XMLString};
-    auto Parser = PositionParser{XMLStream};
+    {
+        auto Writer = XML::Writer{Output};
+        auto Handler = WritingHandler{Writer};
+        auto Parser = XML::BasicParser<WritingHandler>{Handler, std::span<char const>{XMLString}};
+        
+        Parser.Parse();
+    }
+    if(Output != TestString)
+    {
+        throw std::runtime_error{std::format("The XML string \"{}\" was not written as the test string:\n        Expected result: \"{}\"\n          Actual result: \"{}\"", XMLString, TestString, Output)};
+    }
+    
+    // a buffer smaller than most events makes the writer flush and write runs directly
+    auto Path = std::filesystem::temp_directory_path() / "xml_parser_test.xml";
+    
+    for(auto BufferSize : {std::size_t{1}, std::size_t{4}, std::size_t{1 << 20}})
+    {
+        {
+            auto Writer = XML::Writer{Path, BufferSize};
+            auto Handler = WritingHandler{Writer};
+            auto Parser = XML::BasicParser<WritingHandler>{Handler, std::span<char const>{XMLString}};
+            
+            Parser.Parse();
+            Writer.Flush();
+        }
+        
+        auto File = std::ifstream{Path, std::ios::binary};
+        auto FileOutput = std::string{std::istreambuf_iterator<char>{File}, std::istreambuf_iterator<char>{}};
+        
+        if(FileOutput != TestString)
+        {
+            throw std::runtime_error{std::format("The XML string \"{}\" was not written to the file as the test string with a buffer size of {}:\n        Expected result: \"{}\"\n          Actual result: \"{}\"", XMLString, BufferSize, TestString, FileOutput)};
+        }
+    }
+    std::filesystem::remove(Path);
+    
+    // the written document parses to the same content
+    auto Handler = ContentHandler{};
+    auto Parser = XML::BasicParser<ContentHandler>{Handler, std::span<char const>{XMLString}};
+    auto OutputHandler = ContentHandler{};
+    auto OutputParser = XML::BasicParser<ContentHandler>{OutputHandler, std::span<char const>{Output}};
+    
+    Parser.Parse();
+    OutputParser.Parse();
+    if(OutputHandler.GetResult() != Handler.GetResult())
+    {
+        throw std::runtime_error{std::format("The written XML string \"{}\" did not evaluate to the content of \"{}\".", Output, XMLString)};
+    }
+}
+
+/**
+ * Output made only of markup has to be flushed in blocks of the buffer size, too.
+ **/
+auto TestWriterFlushing() -> void
+{
+    auto Path = std::filesystem::temp_directory_path() / "xml_parser_test.xml";
+    auto TestString = std::string{"<a>"};
+    
+    {
+        auto Writer = XML::Writer{Path, 64};
+        
+        Writer.ElementStart("a");
+        for(auto Index = 0; Index < 1000; ++Index)
+        {
+            Writer.ElementStart("b");
+            Writer.ElementEnd();
+            TestString += "<b/>";
+        }
+        if(std::filesystem::file_size(Path) + 64 < TestString.size())
+        {
+            throw std::runtime_error{std::format("Only {} of {} bytes of markup were flushed with a buffer size of 64.", std::filesystem::file_size(Path), TestString.size())};
+        }
+        Writer.ElementEnd();
+        TestString += "</a>";
+    }
+    
+    auto File = std::ifstream{Path, std::ios::binary};
+    auto FileOutput = std::string{std::istreambuf_iterator<char>{File}, std::istreambuf_iterator<char>{}};
+    
+    std::filesystem::remove(Path);
+    if(FileOutput != TestString)
+    {
+        throw std::runtime_error{std::format("The markup was not written to the file as the test string:\n        Expected result: \"{}\"\n          Actual result: \"{}\"", TestString, FileOutput)};
+    }
+}
+
+auto TestWriterErrors() -> void
+{
+    auto Output = std::string{};
+    auto Writer = XML::Writer{Output};
+    
+    Writer.ElementStart("root");
+    Writer.Attribute("a", "<\"'&>");
+    for(auto Comment : {"a--b", "a-", "-"})
+    {
+        auto Thrown = false;
+        
+        try
+        {
+            Writer.Comment(Comment);
+        }
+        catch(std::invalid_argument const &)
+        {
+            Thrown = true;
+        }
+        if(Thrown == false)
+        {
+            throw std::runtime_error{std::format("The writer accepted the comment \"{}\".", Comment)};
+        }
+    }
+    Writer.Comment("a-b");
+    Writer.ElementEnd();
+    if(Output != "<root a=\"&lt;&quot;&apos;&amp;&gt;\"><!--a-b--></root>")
+    {
+        throw std::runtime_error{std::format("The writer wrote \"{}\" around the rejected comments.", Output)};
+    }
+}
+
+auto TestEventCache(std::string const & XMLString, std::string const & TestString) -> void
+{
+    auto Path = std::filesystem::temp_directory_path() / "xml_parser_test.xml.events";
+    
+    XML::EventCache::Record(std::span<char const>{XMLString}, Path);
+    
+    auto Cache = XML::EventCache{Path};
+    auto Parser = ContentViewParser{};
+    
+    Parser.Replay(Cache);
+    if((Parser.GetResult() != TestString) || (Cache.Matches(std::span<char const>{XMLString}) == false) || (Cache.Matches(std::span<char const>{XMLString + ' '}) == true))
+    {
+        throw std::runtime_error{std::format("The event cache of the XML string \"{}\" did not replay to the content test string:\n        Expected result: \"{}\"\n          Actual result: \"{}\"", XMLString, TestString, Parser.GetResult())};
+    }
+    
+    // a cache that ends inside an event is rejected during the replay
+    if(std::filesystem::file_size(Path) > 0)
+    {
+        std::filesystem::resize_file(Path, std::filesystem::file_size(Path) - 1);
+    }
+    
+    auto Thrown = false;
+    
+    try
+    {
+        auto TruncatedCache = XML::EventCache{Path};
+        auto TruncatedParser = ContentViewParser{};
+        
+        TruncatedParser.Replay(TruncatedCache);
+    }
+    catch(std::runtime_error const &)
+    {
+        Thrown = true;
+    }
+    std::filesystem::remove(Path);
+    if(Thrown == false)
+    {
+        throw std::runtime_error{std::format("The truncated event cache of the XML string \"{}\" was replayed.", XMLString)};
+    }
+}
+
+/**
+ * The path dispatcher skips elements and reports locations, which have to be the same whether it
+ * parses or replays.
+ **/
+auto TestEventCacheReplay() -> void
+{
+    auto const XMLString = std::string{"<feed>\n<entry type=\"a\"><title>One</title></entry>\n<entry><title>Two</title><item type=\"b\"><title>Three</title></item></entry><!-- c --></feed>"};
+    auto Path = std::filesystem::temp_directory_path() / "xml_parser_test.xml.events";
+    
+    XML::EventCache::Record(std::span<char const>{XMLString}, Path);
+    
+    auto const Cache = XML::EventCache{Path};
+    auto Results = std::vector<std::string>{};
+    
+    for(auto Replayed : {false, true})
+    {
+        auto Result = std::string{};
+        auto Dispatcher = XML::PathDispatcher{std::span<char const>{XMLString}};
+        auto Subscription = XML::PathSubscription{};
+        auto SymbolTable = XML::SymbolTable{};
+        
+        Subscription.ElementStart = [&Result](std::string_view TagName, XML::Attributes Attributes, XML::Location const & StartLocation) { Result += std::format("+{}/{}@{}:{}:{} ", TagName, Attributes.size(), StartLocation.Line, StartLocation.Column, StartLocation.Offset); };
+        Subscription.Text = [&Result](std::string_view Text, XML::Location const & StartLocation) { Result += std::format("={}@{} ", Text, StartLocation.Offset); };
+        Dispatcher.Subscribe("/feed/entry[@type]/title", Subscription);
+        Dispatcher.Subscribe("//item", Subscription);
+        Dispatcher.SetSymbolTable(&SymbolTable);
+        if(Replayed == true)
+        {
+            Dispatcher.Replay(Cache);
+        }
+        else
+        {
+            Dispatcher.Parse();
+        }
+        Results.push_back(Result);
+    }
+    
+    // after a replay that failed on a corrupt event, the dispatcher skips elements while parsing again
+    XML::EventCache::Record(std::span<char const>{std::string_view{"<x/>"}}, Path);
+    {
+        auto CacheFile = std::ofstream{Path, std::ios::binary | std::ios::app};
+        
+        CacheFile << '\x7f';
+    }
+    
+    auto const CorruptCache = XML::EventCache{Path};
+    auto Statistics = XML::Statistics{};
+    auto Texts = std::string{};
+    auto Dispatcher = XML::PathDispatcher{std::span<char const>{XMLString}};
+    auto Subscription = XML::PathSubscription{};
+    auto Thrown = false;
+    
+    Subscription.Text = [&Texts](std::string_view Text, XML::Location const &) { Texts += Text; };
+    Dispatcher.Subscribe("/feed/entry[@type]/title", Subscription);
+    try
+    {
+        Dispatcher.Replay(CorruptCache);
+    }
+    catch(std::runtime_error const &)
+    {
+        Thrown = true;
+    }
+    Texts.clear();
+    Dispatcher.SetStatistics(&Statistics);
+    Dispatcher.Parse();
+    std::filesystem::remove(Path);
+    if((Thrown == false) || (Texts != "One") || (Statistics.ElementStartCount != 4))
+    {
+        throw std::runtime_error{std::format("Parsing after a failed replay resulted in \"{}\" with {} element starts.", Texts, Statistics.ElementStartCount)};
+    }
+    if((Results[0] != Results[1]) || (Results[0].empty() == true))
+    {
+        throw std::runtime_error{std::format("The replayed path subscriptions resulted in:\n        Expected result: \"{}\"\n          Actual result: \"{}\"", Results[0], Results[1])};
+    }
+}
+
+auto Compress(std::string_view Data, int WindowBits) -> std::string
+{
+    auto Stream = z_stream{};
+    auto Result = std::string(deflateBound(&Stream, static_cast<uLong>(Data.size())) + 32, '\0');
+    
+    if(deflateInit2(&Stream, Z_BEST_COMPRESSION, Z_DEFLATED, WindowBits, 8, Z_DEFAULT_STRATEGY) != Z_OK)
+    {
+        throw std::runtime_error{"Could not initialize the compression."};
+    }
+    Stream.next_in = reinterpret_cast<Bytef const *>(Data.data());
+    Stream.avail_in = static_cast<uInt>(Data.size());
+    Stream.next_out = reinterpret_cast<Bytef *>(Result.data());
+    Stream.avail_out = static_cast<uInt>(Result.size());
+    if(deflate(&Stream, Z_FINISH) != Z_STREAM_END)
+    {
+        deflateEnd(&Stream);
+        
+        throw std::runtime_error{"Could not compress the data."};
+    }
+    Result.resize(Stream.total_out);
+    deflateEnd(&Stream);
+    
+    return Result;
+}
+
+auto TestCompressedFile(std::string const & XMLString, std::string const & TestString) -> void
+{
+    auto Path = std::filesystem::temp_directory_path() / "xml_parser_test.xml.gz";
+    auto const Half = XMLString.size() / 2;
+    // a gzip file, a gzip file of two members and a zlib stream
+    auto const CompressedStrings = std::vector<std::string>{Compress(XMLString, 15 + 16), Compress(std::string_view{XMLString}.substr(0, Half), 15 + 16) + Compress(std::string_view{XMLString}.substr(Half), 15 + 16), Compress(XMLString, 15)};
+    
+    for(auto const & CompressedString : CompressedStrings)
+    {
+        {
+            auto CompressedFile = std::ofstream{Path, std::ios::binary};
+            
+            CompressedFile << CompressedString;
+        }
+        for(auto BlockSize : {std::size_t{1}, std::size_t{3}, std::size_t{1024 * 1024}})
+        {
+            for(auto BlockCount : {std::size_t{2}, std::size_t{5}})
+            {
+                auto Parser = ContentViewParser{std::make_unique<XML::CompressedFileInputSource>(Path, BlockSize, BlockCount)};
+                
+                Parser.Parse();
+                if(Parser.GetResult() != TestString)
+                {
+                    throw std::runtime_error{std::format("The compressed XML file with \"{}\" did not evaluate to the content test string with a block size of {} and {} blocks:\n        Expected result: \"{}\"\n          Actual result: \"{}\"", XMLString, BlockSize, BlockCount, TestString, Parser.GetResult())};
+                }
+            }
+        }
+        
+        // the decompression has to stop when the input source is destroyed before its end
+        auto Source = XML::CompressedFileInputSource{Path, 1, 2};
+        
+        Source.Read();
+    }
+    
+    // a truncated stream and data that is not compressed are errors, after the data in front of them
+    for(auto const & BrokenString : {CompressedStrings[0].substr(0, CompressedStrings[0].size() - 4), "x" + XMLString})
+    {
+        {
+            auto CompressedFile = std::ofstream{Path, std::ios::binary};
+            
+            CompressedFile << BrokenString;
+        }
+        
+        auto Thrown = false;
+        
+        try
+        {
+            auto Source = XML::CompressedFileInputSource{Path, 7, 2};
+            
+            while(Source.Read().empty() == false)
+            {
+            }
+        }
+        catch(std::runtime_error const &)
+        {
+            Thrown = true;
+        }
+        if(Thrown == false)
+        {
+            std::filesystem::remove(Path);
+            
+            throw std::runtime_error{std::format("The broken compressed XML file with \"{}\" was read to its end.", XMLString)};
+        }
+    }
+    std::filesystem::remove(Path);
+}
+
+auto TestInitialization() -> void
+{
+    auto const TestString = std::string{"[+a|x=1](hello){ comment }[-a]"};
+    
+    if(InitializationResult != TestString)
+    {
+        throw std::runtime_error{std::format("Parsing during the initialization resulted in:\n        Expected result: \"{}\"\n          Actual result: \"{}\"", TestString, InitializationResult)};
+    }
+}
+
+auto TestMappedFile(std::string const & XMLString, std::string const & TestString) -> void
+{
+    auto Path = std::filesystem::temp_directory_path() / "xml_parser_test.xml";
+    
+    {
+        auto XMLFile = std::ofstream{Path, std::ios::binary};
+        
+        XMLFile << XMLString;
+    }
+    
+    auto Parser = ContentViewParser{std::make_unique<XML::MappedFileInputSource>(Path)};
     
     Parser.Parse();
+    std::filesystem::remove(Path);
     
     auto ResultString = Parser.GetResult();
     
     if(ResultString != TestString)
     {
-        throw std::runtime_error{std::format("The XML string \"{}\" did not evaluate to the position test string:\n        Expected result: \"{}\"\n          Actual result: \"{}\"", XMLString, TestString, ResultString)};
+        throw std::runtime_error{std::format("The XML file with \"{}\" did not evaluate to the content test string:\n        Expected result: \"{}\"\n          Actual result: \"{}\"", XMLString, TestString, ResultString)};
     }
-    //~ std::cout << "<<<<" << std::endl;
 }
 
 auto main([[maybe_unused]] int argc, [[maybe_unused]] char * argv[]) -> int
@@ -178,6 +1738,8 @@ auto main([[maybe_unused]] int argc, [[maybe_unused]] char * argv[]) -> int
     TestContent("<root attribute='value'/>", "[+root|attribute=value][-root]");
     TestContent("<root attribute='value\"'/>", "[+root|attribute=value\"][-root]");
     TestContent("<root attribute1=\"value1\" attribute2=\"value2\"/>", "[+root|attribute1=value1|attribute2=value2][-root]");
+    TestContent("<root attribute=\"value1\" attribute=\"value2\"/>", "[+root|attribute=value2][-root]");
+    TestContent("<root attribute=\"value1\" other=\"value\" attribute=\"value2\"/>", "[+root|attribute=value2|other=value][-root]");
     TestContent("<root attribute=\"  value\"/>", "[+root|attribute=  value][-root]");
     TestContent("<root attribute=\"value  \"/>", "[+root|attribute=value  ][-root]");
     TestContent("<root attribute=\"va  lue\"/>", "[+root|attribute=va  lue][-root]");
@@ -197,6 +1759,14 @@ auto main([[maybe_unused]] int argc, [[maybe_unused]] char * argv[]) -> int
     TestContent("<root><!-- & --></root>", "[+root]{ & }[-root]");
     TestContent("<root><!-- \" --></root>", "[+root]{ \" }[-root]");
     TestContent("<root><!-- / --></root>", "[+root]{ / }[-root]");
+    TestContent("<r><!--a--'b--></r>", "[+r]{a--b}[-r]");
+    TestContent("<r><!--a--&b--></r>", "[+r]{a--b}[-r]");
+    TestContent("<r><!--a--\"b--></r>", "[+r]{a--b}[-r]");
+    TestContent("<r><!--a--/b--></r>", "[+r]{a--b}[-r]");
+    TestContent("<r><!--'--'--></r>", "[+r]{'--}[-r]");
+    TestContent("<r><!--a--'--b--></r>", "[+r]{a----b}[-r]");
+    TestContent("<r><!--a--\"-b--></r>", "[+r]{a---b}[-r]");
+    TestContent("<r><!--a---'b--></r>", "[+r]{a---b}[-r]");
     TestContent("<root><!-- -< --></root>", "[+root]{ -< }[-root]");
     TestContent("<root><!-- -> --></root>", "[+root]{ -> }[-root]");
     TestContent("<root><!-- -! --></root>", "[+root]{ -! }[-root]");
@@ -215,6 +1785,14 @@ auto main([[maybe_unused]] int argc, [[maybe_unused]] char * argv[]) -> int
     TestContent("<root attribute=\"h&quot;m\"/>", "[+root|attribute=h\"m][-root]");
     TestContent("<root attribute=\"h&apos;m\"/>", "[+root|attribute=h'm][-root]");
     TestContent("<root attribute=\"h&apos;&amp;m\"/>", "[+root|attribute=h'&m][-root]");
+    TestContent("<root>&#65;&#x41;&#X41;</root>", "[+root](AA&#X41;)[-root]");
+    TestContent("<root>&#233;&#xe9;&#xE9;</root>", "[+root](\u00e9\u00e9\u00e9)[-root]");
+    TestContent("<root>&#x20AC;&#x1F600;</root>", "[+root](\u20ac\U0001f600)[-root]");
+    TestContent("<root>&#9;&#10;&#13;</root>", "[+root](\t\n\r)[-root]");
+    TestContent("<root>&#0;&#xD800;&#xFFFE;&#x110000;&#99999999999;</root>", "[+root](&#0;&#xD800;&#xFFFE;&#x110000;&#99999999999;)[-root]");
+    TestContent("<root>&#;&#x;&#12a;&#xg;</root>", "[+root](&#;&#x;&#12a;&#xg;)[-root]");
+    TestContent("<root attribute=\"&#60;&#x3E;\"/>", "[+root|attribute=<>][-root]");
+    TestContent("<root attribute='&#x10FFFF;'/>", "[+root|attribute=\U0010ffff][-root]");
     TestContent("<root attribute=\"!\"/>", "[+root|attribute=!][-root]");
     TestContent("<root attribute=\"value!\"/>", "[+root|attribute=value!][-root]");
     TestContent("<root attribute=\"!value\"/>", "[+root|attribute=!value][-root]");
@@ -241,4 +1819,149 @@ auto main([[maybe_unused]] int argc, [[maybe_unused]] char * argv[]) -> int
     TestContent("<root><!-- --- --></root>", "[+root]{ --- }[-root]");
     TestContent("<root><!-- ---- --></root>", "[+root]{ ---- }[-root]");
     TestContent("<root><!-- <t-e-s-t></t-e-s-t> --></root>", "[+root]{ <t-e-s-t></t-e-s-t> }[-root]");
+    // testing special characters at every position relative to the vectorized scans
+    for(auto Length = 0; Length < 70; ++Length)
+    {
+        auto Before = std::string(Length, 'a');
+        auto After = std::string(70 - Length, 'b');
+        
+        TestContent("<root>" + Before + "&amp;" + After + "</root>", "[+root](" + Before + "&" + After + ")[-root]");
+        TestContent("<root><!--" + Before + "-" + After + "--></root>", "[+root]{" + Before + "-" + After + "}[-root]");
+        TestContent("<root a=\"" + Before + "&quot;" + After + "\"/>", "[+root|a=" + Before + "\"" + After + "][-root]");
+        TestContent("<root a='" + Before + "&apos;" + After + "'/>", "[+root|a=" + Before + "'" + After + "][-root]");
+        TestPosition("<root>" + Before + "\n" + After + "<child/></root>", "0:0+root0:6=" + Before + "\n" + After + std::format("1:{}+child", 70 - Length));
+    }
+    // testing a parser that is fed several documents
+    {
+        auto Parser = ContentViewParser{};
+        
+        Parser.Feed(std::string_view{"<first>te"});
+        Parser.Feed(std::string_view{"xt</fir"});
+        Parser.Feed(std::string_view{"st><unfinished attribute=\"val"});
+        Parser.Finish();
+        Parser.Feed(std::string_view{"<second/>"});
+        Parser.Finish();
+        if(Parser.GetResult() != "[+first](text)[-first][+second][-second]")
+        {
+            throw std::runtime_error{std::format("Feeding several documents to one parser resulted in \"{}\".", Parser.GetResult())};
+        }
+    }
+    // testing document navigation
+    {
+        auto XMLString = std::string_view{"<root>\n\t<child name=\"first\"/>\n\t<child name=\"second\">text</child>\n</root>"};
+        auto Document = XML::Document{};
+        auto DocumentBuilder = XML::DocumentBuilder{Document, std::span<char const>{XMLString}};
+        
+        DocumentBuilder.Parse();
+        
+        auto Root = Document.GetRoot().GetFirstChild();
+        auto Second = Root->GetFirstChild()->GetNextSibling()->GetNextSibling()->GetNextSibling();
+        
+        if((Document.GetNodeCount() != 8) || (Root->GetName() != "root") || (Second->FindAttribute("name") != "second") || (Second->FindAttribute("missing").has_value() == true) || (Second->GetFirstChild()->GetText() != "text") || (Second->GetLocation().Line != 2) || (Second->GetParent()->GetName() != "root"))
+        {
+            throw std::runtime_error{"Navigating the document failed."};
+        }
+        Document.Clear();
+        if((Document.GetNodeCount() != 1) || (Document.GetRoot().GetFirstChild().has_value() == true))
+        {
+            throw std::runtime_error{"Clearing the document failed."};
+        }
+    }
+    // testing memory mapped files
+    TestFindAttribute("<root/>", "attribute", std::nullopt);
+    TestFindAttribute("<root attribute=\"value\"/>", "attribute", "value");
+    TestFindAttribute("<root attribute=\"value\"/>", "other", std::nullopt);
+    TestFindAttribute("<root attribute1=\"value1\" attribute2='value2'>text</root>", "attribute2", "value2");
+    TestFindAttribute("<root attribute=\"value1\" attribute=\"value2\"/>", "attribute", "value2");
+    TestSymbols();
+    TestParallel();
+    TestBatch();
+    TestStatistics();
+    TestSkip("<root><skip/>text</root>", "[+root][+skip][-skip](text)[-root]");
+    TestSkip("<root><skip>text</skip>text</root>", "[+root][+skip][-skip](text)[-root]");
+    TestSkip("<root><skip><a><b/>text</a><a x=\"1\"></a></skip><a/></root>", "[+root][+skip][-skip][+a][-a][-root]");
+    TestSkip("<root><skip><skip>text</skip></skip><skip/></root>", "[+root][+skip][-skip][+skip][-skip][-root]");
+    TestSkip("<root><skip a=\"/>\" b='</skip>'><!-- </skip> --><!----><c d=\">\"/></skip></root>", "[+root][+skip|a=/|b=/skip][-skip][-root]");
+    TestSkip("<root><skip><!-- - -- </skip> ---><!--></skip>--></skip>(text)</root>", "[+root][+skip][-skip]((text))[-root]");
+    TestSkip("<root><skip>" + std::string(1000, 'x') + "</skip  ><a/></root>", "[+root][+skip][-skip][+a][-a][-root]");
+    {
+        auto Reader = XML::Reader{std::span<char const>{std::string_view{"<root><skip>\n<a/>\n</skip>text</root>"}}};
+        
+        Reader.Next();
+        Reader.Next();
+        Reader.SkipElement();
+        if((Reader.Next() != XML::EventKind::ElementEnd) || (Reader.GetName() != "skip") || (Reader.Next() != XML::EventKind::Text) || (Reader.GetLocation().Line != 2) || (Reader.GetLocation().Column != 7))
+        {
+            throw std::runtime_error{"The location after a skipped element is wrong."};
+        }
+    }
+    TestPaths();
+    TestEventPipeline();
+    TestWriter("<root/>", "<root/>");
+    TestWriter("<root></root>", "<root/>");
+    TestWriter("<root a=\"1\" b='x&quot;y'>text<!-- c --><child/></root>", "<root a=\"1\" b=\"x&quot;y\">text<!-- c --><child/></root>");
+    TestWriter("<root>&lt;&amp;&gt;&apos;&quot;</root>", "<root>&lt;&amp;&gt;'\"</root>");
+    TestWriter("<root a='&lt;&apos;'>&#x20AC;" + std::string(100, 'x') + "&amp;</root>", "<root a=\"&lt;&apos;\">\xe2\x82\xac" + std::string(100, 'x') + "&amp;</root>");
+    TestWriter(" <a><b>x</b>\n<c/></a>", " <a><b>x</b>\n<c/></a>");
+    TestWriterErrors();
+    TestWriterFlushing();
+    TestEventCache("<root/>", "[+root][-root]");
+    TestEventCache("<root attribute=\"value\" other='&lt;'>text<!-- comment --><child>&amp;&#x20AC;</child></root>", "[+root|attribute=value|other=<](text){ comment }[+child](&\xe2\x82\xac)[-child][-root]");
+    TestEventCache(" <a><b><c/></b><b x=\"1\" y=\"2\" z=\"3\"/></a>\n", "( )[+a][+b][+c][-c][-b][+b|x=1|y=2|z=3][-b][-a]");
+    TestEventCacheReplay();
+    TestLocations("<root/>", {0});
+    TestLocations(" <root>\n\ttext&amp;\n<!-- c\n -->\n<a b=\"c\">\n</a></root>", {0, 1, 7, 19, 30, 31, 40});
+    TestElementIndex("<root/>", "/root", 0, "[+root][-root]");
+    TestElementIndex("<root/>", "/root", 1, std::nullopt);
+    TestElementIndex("<root/>", "/other", 0, std::nullopt);
+    TestElementIndex("<archive><record id=\"1\"><name>a</name></record><!-- <record> --><record id=\"2\">text<name>b</name></record><other/><record id=\"3\"/></archive>", "/archive/record", 1, "[+record|id=2](text)[+name](b)[-name][-record]");
+    TestElementIndex("<archive><record id=\"1\"><name>a</name></record><!-- <record> --><record id=\"2\">text<name>b</name></record><other/><record id=\"3\"/></archive>", "/archive/record", 2, "[+record|id=3][-record]");
+    TestElementIndex("<archive><record id=\"1\"><name>a</name></record><!-- <record> --><record id=\"2\">text<name>b</name></record><other/><record id=\"3\"/></archive>", "/archive/record", 3, std::nullopt);
+    TestElementIndex("<archive><record id=\"1\"><name>a</name></record><!-- <record> --><record id=\"2\">text<name>b</name></record><other/><record id=\"3\"/></archive>", "/archive/record/name", 1, "[+name](b)[-name]");
+    TestElementIndex("<a><a><a>&amp;</a></a><a x='&lt;'><!-- c --></a></a>", "/a/a", 1, "[+a|x=<]{ c }[-a]");
+    TestElementIndex("<a><a><a>&amp;</a></a><a x='&lt;'><!-- c --></a></a>", "/a/a/a", 0, "[+a](&)[-a]");
+    TestElementIndex("<a/></b><c>x</c>", "/c", 0, "[+c](x)[-c]");
+    TestElementIndex("<   root>x<\n\tchild a=\"1\"/></root>", "/root", 0, "[+root](x)[+child|a=1][-child][-root]");
+    TestElementIndex("<   root>x<\n\tchild a=\"1\"/></root>", "/root/child", 0, "[+child|a=1][-child]");
+    TestFragments("<root>text</root>", 4, "text;");
+    TestFragments("<root>text</root>", 3, "tex|t;");
+    TestFragments("<root>abcdefgh</root>", 4, "abcd|efgh;");
+    TestFragments("<root>abcdefghi<!-- comment --></root>", 4, "abcd|efgh|i; com|ment| ;");
+    TestFragments("<root>&amp;&lt;&gt;&amp;&lt;&gt;x</root>", 2, "&<|>&|<>|x;");
+    TestFragments("<root><!----></root>", 4, ";");
+    TestFragments("<root>a\xc3\xa9\xe2\x82\xac</root>", 4, "a\xc3\xa9|\xe2\x82\xac;");
+    TestFragments("<root>\xe2\x82\xac</root>", 1, "\xe2|\x82|\xac;");
+    TestFragments("<root>" + std::string(1000, 'x') + "</root>", 400, std::string(400, 'x') + '|' + std::string(400, 'x') + '|' + std::string(200, 'x') + ';');
+    TestRawEntities("<root>text</root>", "[+root](text)[-root]");
+    TestRawEntities("<root>&amp;</root>", "[+root](&amp;)[-root]");
+    TestRawEntities("<root>h&lt;m&gt;</root>", "[+root](h&lt;m&gt;)[-root]");
+    TestRawEntities("<root>&unknown;</root>", "[+root](&unknown;)[-root]");
+    TestRawEntities("<root>&#x20AC;&#65;&#xD800;</root>", "[+root](&#x20AC;&#65;&#xD800;)[-root]");
+    TestRawEntities("<root attribute=\"h&amp;m\"/>", "[+root|attribute=h&amp;m][-root]");
+    TestRawEntities("<root attribute='&apos;&quot;'>&amp;</root>", "[+root|attribute=&apos;&quot;](&amp;)[-root]");
+    {
+        auto Clean = std::string_view{"clean text"};
+        auto Buffer = std::string{};
+        
+        if(XML::DecodeEntities(Clean, Buffer).data() != Clean.data())
+        {
+            throw std::runtime_error{"Decoding a text without entities copied it."};
+        }
+        if(XML::DecodeEntities("a&amp;b&c", Buffer) != "a&b&c")
+        {
+            throw std::runtime_error{"Decoding an unterminated entity failed."};
+        }
+    }
+    TestElementCount("", 0);
+    TestElementCount("<root/>", 1);
+    TestElementCount("<root attribute=\"value\">text<child/><!-- <comment/> --><child>text</child></root>", 3);
+    TestInitialization();
+    TestMappedFile("", "");
+    TestMappedFile("<root attribute=\"value\">text<!-- comment --></root>", "[+root|attribute=value](text){ comment }[-root]");
+    TestCompressedFile("<root attribute=\"value\">text<!-- comment --></root>", "[+root|attribute=value](text){ comment }[-root]");
+    TestCompressedFile("<a>\xe2\x82\xac<b x='1'/>&amp;&#x20AC;</a>", "[+a](\xe2\x82\xac)[+b|x=1][-b](&\xe2\x82\xac)[-a]");
+    // testing content across input blocks
+    auto LongText = std::string(100000, 'x');
+    
+    TestContent("<root attribute=\"" + LongText + "&amp;\">" + LongText + "<!-- " + LongText + " --></root>", "[+root|attribute=" + LongText + "&](" + LongText + "){ " + LongText + " }[-root]");
 }